@@ -39,6 +39,10 @@ macro(global_set_flags)
         add_definitions(-DTRACE_API)
     endif()
 
+    if(BUILD_WITH_TRACING)
+        add_definitions(-DBUILD_WITH_TRACING)
+    endif()
+
     if(HWM_OVER_XU)
         add_definitions(-DHWM_OVER_XU)
     endif()
@@ -38,6 +38,7 @@ else()
     option(CHECK_FOR_UPDATES "Checks for versions updates" OFF) 
 endif()
 option(BUILD_WITH_CPU_EXTENSIONS "Enable compiler optimizations using CPU extensions (such as AVX)" ON)
+option(BUILD_WITH_TRACING "Build with internal trace spans that can be written to a Chrome trace file at runtime (see rs2_start_trace)" ON)
 set(UNIT_TESTS_ARGS "" CACHE STRING "Command-line arguments to pass to unit-tests-config.py, e.g. '-t <tag> -r <regex>'")
 #Performance improvement with Ubuntu 18/20
 if(UNIX AND (NOT ANDROID_NDK_TOOLCHAIN_INCLUDED))
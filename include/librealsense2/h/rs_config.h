@@ -129,6 +129,17 @@ extern "C" {
     */
     void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_error ** error);
 
+    /**
+    * Requires that the pipeline delivers only the latest frameset: frames superseded before the application gets to
+    * them are released immediately, and a callback that is still busy with a frameset gets the freshest one next,
+    * rather than every frameset in turn
+    *
+    * \param[in] config      A pointer to an instance of a config
+    * \param[in] conflating  Non-zero to deliver only the latest frameset
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_set_conflating(rs2_config* config, int conflating, rs2_error ** error);
+
 
     /**
     * Disable a device stream explicitly, to remove any requests on this stream type.
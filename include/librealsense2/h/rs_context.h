@@ -42,6 +42,8 @@ rs2_context* rs2_create_context(int api_version, rs2_error** error);
 *             raw: leave all formats from camera as they are
 *         options-update-interval: 1000 - (uint32_t) time interval in milliseconds for option value change notifications
 *             (see rs2_set_options_changed_callback)
+*         playback-index: false         - (bool) whether loading a recording without an index writes one next to it
+*             (<file>.idx), so it opens faster the next time; see rs2_create_record_device_with_settings
 * \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
 * \return            Context object
 */
@@ -90,6 +90,21 @@ typedef enum rs2_calib_target_type
 } rs2_calib_target_type;
 const char* rs2_calib_target_type_to_string(rs2_calib_target_type type);
 
+/** \brief Hops of a frame on its way to the application, as recorded by frame tracing (see rs2_enable_frame_trace). */
+typedef enum rs2_frame_trace_stage
+{
+    RS2_FRAME_TRACE_STAGE_ARRIVAL,          /**< The backend received the frame (when it reports it; otherwise, the sensor did) */
+    RS2_FRAME_TRACE_STAGE_CONVERSION_START, /**< Format conversion started */
+    RS2_FRAME_TRACE_STAGE_CONVERSION_END,   /**< Format conversion produced the frame */
+    RS2_FRAME_TRACE_STAGE_SYNC_START,       /**< The frame entered the syncer */
+    RS2_FRAME_TRACE_STAGE_SYNC_END,         /**< The syncer released the frame */
+    RS2_FRAME_TRACE_STAGE_PROCESSING_START, /**< A processing block started processing the frame */
+    RS2_FRAME_TRACE_STAGE_PROCESSING_END,   /**< A processing block produced the frame */
+    RS2_FRAME_TRACE_STAGE_DELIVERY,         /**< The frame was handed to the application (callback or queue) */
+    RS2_FRAME_TRACE_STAGE_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
+} rs2_frame_trace_stage;
+const char* rs2_frame_trace_stage_to_string(rs2_frame_trace_stage stage);
+
 /**
 * retrieve metadata from frame handle
 * \param[in] frame      handle returned from a callback
@@ -99,6 +114,33 @@ const char* rs2_calib_target_type_to_string(rs2_calib_target_type type);
 */
 rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* Enable or disable frame tracing for the whole process. While enabled, every frame records a monotonic timestamp at
+* each hop through the library (arrival, format conversion, syncer, processing blocks, delivery). Frames allocated
+* while tracing was disabled record nothing more than their later hops.
+* \param[in] enable     non-zero to enable tracing
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_frame_trace(int enable, rs2_error** error);
+
+/**
+* retrieve the number of trace events recorded for a frame
+* \param[in] frame      handle returned from a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the number of trace events, 0 if tracing was not enabled
+*/
+int rs2_get_frame_trace_size(const rs2_frame* frame, rs2_error** error);
+
+/**
+* retrieve a trace event of a frame; events are ordered by the time they were recorded
+* \param[in] frame      handle returned from a callback
+* \param[in] index      index of the event, less than rs2_get_frame_trace_size
+* \param[out] stage     the hop at which the event was recorded
+* \param[out] time      time of the event in milliseconds of a monotonic clock; only differences between events are meaningful
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_trace_event(const rs2_frame* frame, int index, rs2_frame_trace_stage* stage, rs2_time_t* time, rs2_error** error);
+
 /**
 * determine device metadata
 * \param[in] frame             handle returned from a callback
@@ -108,6 +150,19 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve all the metadata of a frame in a single call, rather than calling rs2_supports_frame_metadata and
+* rs2_get_frame_metadata for each value
+* \param[in] frame      handle returned from a callback
+* \param[out] values    receives the metadata values, indexed by rs2_frame_metadata_value; 0 where not supported
+* \param[out] is_valid  receives, at the same indexes, 1 where the frame supports the metadata and 0 otherwise
+* \param[in] count      number of entries in values and is_valid, normally RS2_FRAME_METADATA_COUNT; entries beyond the
+*                       metadata known to the library are marked as not supported
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the number of metadata values the frame supports
+*/
+int rs2_get_frame_metadata_values(const rs2_frame* frame, rs2_metadata_type* values, unsigned char* is_valid, int count, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
@@ -124,6 +124,12 @@ extern "C" {
         RS2_OPTION_OHM_TEMPERATURE, /**< Temperature of the Optical Head Sensor */
         RS2_OPTION_SOC_PVT_TEMPERATURE, /**< Temperature of PVT SOC */
         RS2_OPTION_GYRO_SENSITIVITY,/**< Control of the gyro sensitivity level, see rs2_gyro_sensitivity for values */ 
+        RS2_OPTION_FILTER_ROI_MIN_X, /**< Left edge (inclusive, in input pixels) of the region of interest a post-processing block computes. An empty region processes the whole frame */
+        RS2_OPTION_FILTER_ROI_MIN_Y, /**< Top edge (inclusive, in input pixels) of the post-processing region of interest */
+        RS2_OPTION_FILTER_ROI_MAX_X, /**< Right edge (exclusive, in input pixels) of the post-processing region of interest */
+        RS2_OPTION_FILTER_ROI_MAX_Y, /**< Bottom edge (exclusive, in input pixels) of the post-processing region of interest */
+        RS2_OPTION_FILTER_ROI_HALO, /**< Number of context pixels around the region of interest fed to neighbourhood filters. Pixels outside the region are invalidated */
+        RS2_OPTION_RESULT_CACHE_SIZE, /**< Number of recent results a processing block keeps to serve repeated processing of the same input frame without recomputing it. 0 disables the cache */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
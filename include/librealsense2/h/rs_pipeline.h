@@ -210,6 +210,17 @@ extern "C" {
     */
     rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_error ** error);
 
+    /**
+    * Return the start-up timing of the last successful \c start(), as JSON text: the time spent resolving the configuration
+    * (and whether a previous resolution for the same device and configuration was reused), opening every sensor, and
+    * starting streaming, all in milliseconds.
+    *
+    * \param[in] pipe    a pointer to an instance of the pipeline
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return  Buffer holding the JSON report. Must be released with rs2_delete_raw_data.
+    */
+    rs2_raw_data_buffer* rs2_pipeline_get_start_report(rs2_pipeline* pipe, rs2_error ** error);
+
     /**
     * Retrieve the device used by the pipeline.
     * The device class provides the application access to control camera additional settings -
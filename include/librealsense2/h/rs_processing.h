@@ -35,6 +35,53 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates a sync processing block that groups the frames of several devices (e.g. hardware-synced cameras) into one
+* frameset by timestamp. The devices must share a time domain, i.e. global time must be enabled on all of them.
+* \param[in] tolerance_ms  maximum timestamp difference, in milliseconds, of frames in one frameset; 0 to use half a
+*                          frame period
+* \param[in] max_wait_ms   maximum time, in milliseconds, a frameset is held waiting for a missing device; 0 for no
+*                          bound other than the usual frame-rate based cutout
+* \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(float tolerance_ms, float max_wait_ms, rs2_error** error);
+
+/**
+* Starts or stops collecting the latency statistics of a sync processing block; they are not collected by default, as
+* they add to the cost of syncing every frame
+* \param[in] block    sync processing block
+* \param[in] enable   non-zero to collect statistics, zero to stop (what was collected is kept)
+* \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_syncer_statistics(rs2_processing_block* block, int enable, rs2_error** error);
+
+/**
+* Returns the latency statistics of a sync processing block, as JSON text: per-stream hold time histograms (the time
+* frames waited inside the syncer for their partners), drop counts, and the number of framesets released per reason,
+* collected while enabled (see rs2_enable_syncer_statistics)
+* \param[in] block    sync processing block
+* \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            buffer holding the JSON text; must be released with rs2_delete_raw_data
+*/
+rs2_raw_data_buffer* rs2_get_syncer_statistics(rs2_processing_block* block, rs2_error** error);
+
+/**
+* Clears the latency statistics of a sync processing block
+* \param[in] block    sync processing block
+* \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_reset_syncer_statistics(rs2_processing_block* block, rs2_error** error);
+
+/**
+* Returns the frame memory and queue telemetry of a processing block, as JSON text: the counters of its frame archives
+* (see rs2_get_sensor_telemetry) and, for a syncer, the occupancy of its output queue and, while statistics are enabled,
+* the frames held per stream
+* \param[in] block    processing block
+* \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            buffer holding the JSON text; must be released with rs2_delete_raw_data
+*/
+rs2_raw_data_buffer* rs2_get_processing_block_telemetry(rs2_processing_block* block, rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -147,6 +194,21 @@ void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* qu
 */
 void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error** error);
 
+/**
+* This method is used to pass a batch of frames through a chain of processing blocks, for offline processing.
+* Each block of the chain runs on its own thread, so consecutive blocks work on consecutive frames concurrently;
+* every block still receives the frames one by one and in order. While the call is in progress the blocks' output
+* is redirected to the batch, and the blocks must not be invoked by anyone else
+* \param[in] blocks         Processing blocks, in processing order
+* \param[in] block_count    Number of processing blocks
+* \param[in] frames         Frames to process, ownership is moved to the processing blocks
+* \param[in] frame_count    Number of frames
+* \param[out] results       Array of frame_count entries, receiving for every input frame the last frame the chain
+*                           produced from it, or null if it was dropped. The caller must release the result frames
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_process_frames(rs2_processing_block** blocks, int block_count, rs2_frame** frames, int frame_count, rs2_frame** results, rs2_error** error);
+
 /**
 * Deletes the processing block
 * \param[in] block          Processing block
@@ -175,6 +237,15 @@ void rs2_delete_frame_queue(rs2_frame_queue* queue);
 */
 int rs2_frame_queue_size(rs2_frame_queue* queue, rs2_error** error);
 
+/**
+* sets whether the queue conflates its frames: a conflating queue keeps only the latest frame, releasing any frame it
+* supersedes immediately, so that the consumer always gets the freshest one
+* \param[in] queue       the frame queue data structure
+* \param[in] conflating  non-zero to conflate, 0 to queue frames up to the queue capacity
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_queue_conflating(rs2_frame_queue* queue, int conflating, rs2_error** error);
+
 /**
 * wait until new frame becomes available in the queue and dequeue it
 * \param[in] queue the frame queue data structure
@@ -285,6 +356,36 @@ rs2_processing_block* rs2_create_hdr_merge_processing_block(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error);
 
+/**
+* Creates a depth encoder processing block. The block losslessly compresses Z16 depth frames to the Z16RVL format,
+* coding runs of invalid (zero) pixels and the deltas between valid ones, which typically takes a fraction of the size
+* of the raw depth and several times less than generic compression
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            RVL encoder processing block
+*/
+rs2_processing_block* rs2_create_rvl_encoder_block(rs2_error** error);
+
+/**
+* Creates a depth decoder processing block. The block decodes Z16RVL frames back to Z16 depth frames
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            RVL decoder processing block
+*/
+rs2_processing_block* rs2_create_rvl_decoder_block(rs2_error** error);
+
+/**
+* Creates a processing graph: a directed acyclic graph of processing blocks described in JSON, whose independent
+* branches are executed concurrently. Each node names a block, its inputs (stream types of the incoming frameset or
+* other nodes) and optionally its options, e.g.
+*   {"nodes":[{"name":"filtered","block":"Spatial Filter","inputs":["depth"],"options":{"Filter Magnitude":3}},
+*             {"name":"cloud","block":"pointcloud","inputs":["filtered"]},
+*             {"name":"aligned","block":"align","settings":{"to":"color"},"inputs":["depth","color"]}],
+*    "outputs":["cloud","aligned"]}
+* The outputs of the graph are combined into a single frameset.
+* \param[in] json_description  graph description
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_processing_graph(const char* json_description, rs2_error** error);
+
 /**
 * Retrieve processing block specific information, like name.
 * \param[in]  block     The processing block
@@ -29,6 +29,16 @@ const char* rs2_playback_status_to_string(rs2_playback_status status);
 
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
+/** \brief The frames a recording device has waiting to be written, and how long they wait */
+typedef struct rs2_record_queue_telemetry
+{
+    unsigned long long frames;      /**< Frames waiting to be written */
+    unsigned long long bytes;       /**< Bytes of frame data waiting to be written */
+    unsigned long long max_bytes;   /**< The most bytes of frame data that waited to be written at once, since recording started */
+    double             latency;     /**< Milliseconds from the arrival of the last frame written until it was written */
+    double             max_latency; /**< The longest such latency of any frame written, in milliseconds */
+} rs2_record_queue_telemetry;
+
 /**
  * Creates a recording device to record the given device and save it to the given file
  * \param[in]  device    The device to record
@@ -48,6 +58,48 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 */
 rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
 
+/**
+* Creates a recording device to record the given device and save it to the given file, configured by a settings JSON
+* \param[in]  device         The device to record
+* \param[in]  file           The desired path to which the recorder should save the data
+* \param[in]  json_settings  Pointer to a string containing a JSON configuration to use, or null if none
+*     Possible <setting>:<default-value> :
+*         compression: <device default>  - (bool) whether the file is compressed (LZ4)
+*         depth-codec: none              - (string) how Z16 depth images are stored:
+*             none: as is
+*             rvl: losslessly RVL-encoded, typically a fraction of the size; playback decodes them back to Z16
+*         index: false                   - (bool) whether an index of the file is written next to it (<file>.idx) once
+*             recording stops: playback then opens the file without reading its index from all over it, and looks
+*             frames up by time or frame number directly
+*         format: bag                    - (string) the file format:
+*             bag: a ROS bag
+*             raw: for capturing video at high rates; video frames are written as is to <file>.frames, with direct I/O
+*                 into preallocated space, and everything else to the bag. Playback of the bag reads both. Not with
+*                 depth-codec, and compression only applies to the bag
+*         pre-trigger: 0                 - (seconds) if non-zero, nothing is written until rs2_record_device_trigger():
+*             until then, the frames of the last pre-trigger seconds are kept in memory, without copying them, and
+*             written first once triggered, the recording starting with the oldest of them. Recording then continues
+*             as usual
+*         pre-trigger-memory: 1024       - (MB) the most frame data kept before the trigger; older frames are dropped
+*             to stay within it
+*         queue-policy: unbounded        - (string) what to do with a frame arriving when the frames waiting to be
+*             written are at queue-memory, e.g. when the disk falls behind:
+*             unbounded: no limit of the recorder's own; the frame is queued. As without a policy, the frames
+*                 waiting are bounded by the sensor's frames queue size (RS2_OPTION_FRAMES_QUEUE_SIZE), and the
+*                 sensor drops frames beyond it; those aren't counted as dropped by the recorder
+*             block: the frame is queued once there's room, blocking the sensor until then
+*             drop-newest: the frame is dropped
+*             drop-by-priority: queued frames of streams of lower stream-priority are dropped to make room, the
+*                 lowest and newest first; if that isn't enough, the frame is dropped
+*             See rs2_record_device_get_frame_counts for the frames dropped
+*         queue-memory: 237              - (MB) the most frame data waiting to be written, unless unbounded
+*         stream-priority: {}            - (object) the priority of streams by name, e.g. {"Depth":1}, for
+*             drop-by-priority; higher is kept first, and streams not in it are of priority 0
+* \param[out] error          If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return A pointer to a device that records its data to file, or null in case of failure
+*/
+rs2_device* rs2_create_record_device_with_settings(const rs2_device* device, const char* file, const char* json_settings, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
@@ -63,6 +115,35 @@ void rs2_record_device_pause(const rs2_device* device, rs2_error** error);
 */
 void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 
+/**
+* Trigger a recording device created with a pre-trigger setting: the frames kept in memory before the trigger are
+* written, followed by everything from now on. Does nothing if already triggered, or without a pre-trigger
+* \param[in]  device    A recording device
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_trigger(const rs2_device* device, rs2_error** error);
+
+/**
+* Gets how many frames of a stream a recording device wrote, and dropped, since it was created. Frames are dropped
+* by the queue-policy setting, or when they fail to be written; the recording is then incomplete
+* \param[in]  device          A recording device
+* \param[in]  stream          The stream type
+* \param[in]  index           The stream index
+* \param[out] frames_written  The frames written
+* \param[out] frames_dropped  The frames dropped
+* \param[out] error           If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_frame_counts(const rs2_device* device, rs2_stream stream, int index,
+                                        unsigned long long* frames_written, unsigned long long* frames_dropped, rs2_error** error);
+
+/**
+* Gets the depth of the queue of frames a recording device has waiting to be written, and their latency
+* \param[in]  device     A recording device
+* \param[out] telemetry  The telemetry
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_queue_telemetry(const rs2_device* device, rs2_record_queue_telemetry* telemetry, rs2_error** error);
+
 /**
 * Gets the name of the file to which the recorder is writing
 * \param[in]  device    A recording device
@@ -150,6 +231,49 @@ void rs2_playback_device_set_real_time(const rs2_device* device, int real_time,
  */
 int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error);
 
+/**
+ * Set the playback to read the file as fast as possible, using all cores: the playback is no longer in real time
+ * mode, and more memory is used to decompress more of the file ahead of the frames being played. Setting the
+ * playback back to real time mode turns this off.
+ * \param[in] device          A playback device
+ * \param[in] max_throughput  0 to read the file ahead at the default rate, otherwise as fast as possible
+ * \param[out] error          If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_max_throughput(const rs2_device* device, int max_throughput, rs2_error** error);
+
+/**
+ * Indicates if playback is reading the file as fast as possible
+ * \param[in] device A playback device
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return True iff playback is in max throughput mode. 0 means false, otherwise true
+ */
+int rs2_playback_device_is_max_throughput(const rs2_device* device, rs2_error** error);
+
+/**
+ * Read a frame of a stream from the file by its number, without streaming. The playback needn't be stopped: the frame
+ * is read between the frames being played back, if any, which aren't affected.
+ * If more than one frame of the stream has the number, the first one is read.
+ * Files not recorded with an index are indexed on load; frame numbers not in the index are read once, on the first call
+ * \param[in] device        A playback device
+ * \param[in] profile       A stream profile of the playback device; all profiles of the same stream are the same
+ * \param[in] frame_number  The number of the frame to read
+ * \param[out] error        If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return The frame, to be released by the caller with rs2_release_frame()
+ */
+rs2_frame* rs2_playback_device_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long frame_number, rs2_error** error);
+
+/**
+ * Read the frames of the given streams nearest a time in the file, as a frameset, without streaming. The playback
+ * needn't be stopped: the frames are read between the frames being played back, if any, which aren't affected.
+ * \param[in] device    A playback device
+ * \param[in] profiles  Stream profiles of the playback device; all profiles of the same stream are the same
+ * \param[in] count     The number of profiles; 0 for every stream with frames in the file
+ * \param[in] time      Time in the file, in nanoseconds, as for rs2_playback_seek()
+ * \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return The frameset, to be released by the caller with rs2_release_frame()
+ */
+rs2_frame* rs2_playback_device_get_frames_at(const rs2_device* device, const rs2_stream_profile** profiles, int count, long long int time, rs2_error** error);
+
 /**
  * Register to receive callback from playback device upon its status changes
  *
@@ -94,6 +94,7 @@ typedef enum rs2_format
     RS2_FORMAT_Y16I            , /**< 12-bit per pixel interleaved. 12-bit left, 12-bit right. */
     RS2_FORMAT_M420            , /**< 24-bit for every pixel: y for each pixel, and u,v data for every four pixels - packed as 2 lines of y, 1 line of u,v */
     RS2_FORMAT_COMBINED_MOTION , /**< Combined motion data, as in the combined_motion structure */
+    RS2_FORMAT_Z16RVL          , /**< Variable-length 16-bit depth values, losslessly compressed with RVL run-length/delta coding. */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -166,6 +167,17 @@ const char* rs2_get_sensor_info(const rs2_sensor* sensor, rs2_camera_info info,
 */
 int rs2_supports_sensor_info(const rs2_sensor* sensor, rs2_camera_info info, rs2_error** error);
 
+/**
+* Returns the frame memory telemetry of a sensor, as JSON text: for each of its frame archives (per stream and frame
+* type), the frames published and currently held, publish failures (all allowed frames still held by the user), the
+* freelist size, and the bytes allocated and recycled; plus the same for the active format converters. The counters are
+* cumulative and cheap to read, e.g. periodically from a monitoring thread.
+* \param[in] sensor     the RealSense sensor
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               buffer holding the JSON text; must be released with rs2_delete_raw_data
+*/
+rs2_raw_data_buffer* rs2_get_sensor_telemetry(const rs2_sensor* sensor, rs2_error** error);
+
 /**
  * Test if the given sensor can be extended to the requested extension
  * \param[in] sensor  Realsense sensor
@@ -342,6 +342,31 @@ namespace rs2
         virtual ~filter_interface() = default;
     };
 
+    /**
+    * Enable or disable frame tracing for the whole process: while enabled, every frame records when it passed each
+    * hop through the library (see frame::get_trace)
+    */
+    inline void enable_frame_trace(bool enable)
+    {
+        rs2_error* e = nullptr;
+        rs2_enable_frame_trace(enable, &e);
+        error::handle(e);
+    }
+
+    /**
+    * All the metadata of a frame, as retrieved at once by frame::get_frame_metadata_values
+    */
+    struct frame_metadata_values
+    {
+        rs2_metadata_type values[RS2_FRAME_METADATA_COUNT];  // indexed by rs2_frame_metadata_value; 0 where not supported
+        unsigned char is_valid[RS2_FRAME_METADATA_COUNT];    // non-zero where the frame supports the metadata
+
+        bool supports(rs2_frame_metadata_value frame_metadata) const
+        {
+            return frame_metadata >= 0 && frame_metadata < RS2_FRAME_METADATA_COUNT && is_valid[frame_metadata];
+        }
+    };
+
     class frame
     {
     public:
@@ -516,6 +541,42 @@ namespace rs2
             return r != 0;
         }
 
+        /** retrieve all the metadata of the frame in a single call, rather than calling supports_frame_metadata and
+        * get_frame_metadata for each value
+        * \param[out] md    receives the metadata values, and which of them the frame supports
+        * \return           the number of metadata values the frame supports
+        */
+        int get_frame_metadata_values(frame_metadata_values& md) const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_metadata_values(frame_ref, md.values, md.is_valid, RS2_FRAME_METADATA_COUNT, &e);
+            error::handle(e);
+            return r;
+        }
+
+        /**
+        * retrieve the hops the frame went through, when frame tracing is enabled (see enable_frame_trace)
+        * \return               (stage, time) pairs, in the order they were recorded; times are in milliseconds of a
+        *                       monotonic clock, so only differences between them are meaningful
+        */
+        std::vector<std::pair<rs2_frame_trace_stage, rs2_time_t>> get_trace() const
+        {
+            rs2_error* e = nullptr;
+            auto size = rs2_get_frame_trace_size(frame_ref, &e);
+            error::handle(e);
+
+            std::vector<std::pair<rs2_frame_trace_stage, rs2_time_t>> trace;
+            for (int i = 0; i < size; ++i)
+            {
+                rs2_frame_trace_stage stage;
+                rs2_time_t time;
+                rs2_get_frame_trace_event(frame_ref, i, &stage, &time, &e);
+                error::handle(e);
+                trace.emplace_back(stage, time);
+            }
+            return trace;
+        }
+
         /**
         * retrieve frame number (from frame handle)
         * \return               the frame number of the frame, in milliseconds since the device was started
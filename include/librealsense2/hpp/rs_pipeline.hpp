@@ -267,6 +267,20 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Requires that the pipeline delivers only the latest frameset: frames superseded before the application gets
+        * to them are released immediately, and a callback that is still busy with a frameset gets the freshest one
+        * next, rather than every frameset in turn.
+        *
+        * \param[in] conflating  true to deliver only the latest frameset
+        */
+        void set_conflating(bool conflating)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_set_conflating(_config.get(), conflating, &e);
+            error::handle(e);
+        }
+
         /**
         * Disable a device stream explicitly, to remove any requests on this stream profile.
         * The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the
@@ -579,6 +593,26 @@ namespace rs2
             return pipeline_profile(p);
         }
 
+        /**
+        * Return the start-up timing of the last successful \c start(), as JSON text: the time spent resolving the
+        * configuration, opening every sensor, and starting streaming, all in milliseconds.
+        */
+        std::string get_start_report() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_pipeline_get_start_report(_pipeline.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         operator std::shared_ptr<rs2_pipeline>() const
         {
             return _pipeline;
@@ -222,6 +222,18 @@ namespace rs2
             return static_cast<size_t>(res);
         }
 
+        /**
+        * Make the queue keep only the latest frame, releasing any frame it supersedes immediately, so that the
+        * consumer always gets the freshest one
+        * \param[in] conflating  true to conflate, false to queue frames up to the queue capacity
+        */
+        void set_conflating(bool conflating) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_queue_conflating(_queue.get(), conflating, &e);
+            error::handle(e);
+        }
+
         /**
         * Return the capacity of the queue
         * \return capacity size
@@ -291,6 +303,59 @@ namespace rs2
             rs2_process_frame(get(), ptr, &e);
             error::handle(e);
         }
+
+        /**
+        * Frame memory and queue telemetry of the block, as JSON text: the counters of its frame archives and, for a
+        * syncer, the occupancy of its queues
+        */
+        std::string get_telemetry() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_processing_block_telemetry(get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
+        /**
+        * Process a batch of frames through a chain of processing blocks, for offline processing. Consecutive blocks
+        * work on consecutive frames concurrently, while each block still receives the frames one by one and in order.
+        * The blocks must not be used by anyone else until the call returns.
+        *
+        * \param[in] chain  - processing blocks, in processing order
+        * \param[in] frames - frames to be processed
+        * return for each input frame, the last frame the chain produced from it (an empty frame if it was dropped)
+        */
+        static std::vector<frame> process_batch(const std::vector<processing_block>& chain, std::vector<frame> frames)
+        {
+            std::vector<rs2_processing_block*> blocks;
+            for (auto&& block : chain)
+                blocks.push_back(block.get());
+
+            std::vector<rs2_frame*> inputs;
+            for (auto&& f : frames)
+            {
+                inputs.push_back(nullptr);
+                std::swap(f.frame_ref, inputs.back());
+            }
+
+            std::vector<rs2_frame*> outputs(inputs.size(), nullptr);
+            rs2_error* e = nullptr;
+            rs2_process_frames(blocks.data(), int(blocks.size()), inputs.data(), int(inputs.size()), outputs.data(), &e);
+            error::handle(e);
+
+            std::vector<frame> results;
+            for (auto ptr : outputs)
+                results.push_back(frame(ptr));
+            return results;
+        }
         /**
         * constructor with already created low level processing block assigned.
         *
@@ -625,6 +690,48 @@ namespace rs2
         */
         asynchronous_syncer() : processing_block(init()) {}
 
+        asynchronous_syncer(std::shared_ptr<rs2_processing_block> block) : processing_block(block) {}
+
+        /**
+        * Start or stop collecting the latency statistics of the syncer; they are not collected by default
+        */
+        void enable_statistics(bool enable = true) const
+        {
+            rs2_error* e = nullptr;
+            rs2_enable_syncer_statistics(get(), enable ? 1 : 0, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Latency statistics of the syncer, as JSON text: per-stream hold time histograms, drop counts, and the number
+        * of framesets released per reason
+        */
+        std::string get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_syncer_statistics(get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
+        /**
+        * Clear the latency statistics of the syncer
+        */
+        void reset_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_reset_syncer_statistics(get(), &e);
+            error::handle(e);
+        }
+
     private:
         std::shared_ptr<rs2_processing_block> init()
         {
@@ -697,11 +804,69 @@ namespace rs2
         {
             _sync.invoke(std::move(f));
         }
+
+        /**
+        * Start or stop collecting the latency statistics of the syncer; they are not collected by default
+        */
+        void enable_statistics(bool enable = true) const { _sync.enable_statistics(enable); }
+
+        /**
+        * Latency statistics of the syncer, as JSON text
+        * \return per-stream hold time histograms, drop counts, and the number of framesets released per reason
+        */
+        std::string get_statistics() const { return _sync.get_statistics(); }
+
+        /**
+        * Frame memory and queue telemetry of the syncer, as JSON text
+        * \return archive counters, output queue occupancy, and the frames held per stream
+        */
+        std::string get_telemetry() const { return _sync.get_telemetry(); }
+
+        /**
+        * Clear the latency statistics of the syncer
+        */
+        void reset_statistics() const { _sync.reset_statistics(); }
+    protected:
+        syncer(asynchronous_syncer sync, int queue_size)
+            : _sync(std::move(sync)), _results(queue_size)
+        {
+            _sync.start(_results);
+        }
     private:
         asynchronous_syncer _sync;
         frame_queue _results;
     };
 
+    /**
+    * Syncer that groups the frames of several devices (e.g. hardware-synced cameras) into one frameset by timestamp.
+    * The devices must share a time domain, i.e. global time must be enabled on all of them.
+    */
+    class multi_device_syncer : public syncer
+    {
+    public:
+        /**
+        * \param[in] tolerance_ms  Maximum timestamp difference of frames in one frameset; 0 to use half a frame period
+        * \param[in] max_wait_ms   Maximum time a frameset is held waiting for a missing device; 0 for no bound
+        * \param[in] queue_size    Size of the queue of resulting framesets
+        */
+        multi_device_syncer(float tolerance_ms = 0.f, float max_wait_ms = 100.f, int queue_size = 1)
+            : syncer(asynchronous_syncer(init(tolerance_ms, max_wait_ms)), queue_size)
+        {
+        }
+
+    private:
+        static std::shared_ptr<rs2_processing_block> init(float tolerance_ms, float max_wait_ms)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_multi_device_sync_processing_block(tolerance_ms, max_wait_ms, &e),
+                rs2_delete_processing_block);
+
+            error::handle(e);
+            return block;
+        }
+    };
+
     /**
     Auxiliary processing block that performs image alignment using depth data and camera calibration
     */
@@ -1188,5 +1353,74 @@ namespace rs2
             return block;
         }
     };
+
+    /**
+    * Losslessly compresses Z16 depth frames to Z16RVL, e.g. to store or send them
+    */
+    class rvl_encoder : public filter
+    {
+    public:
+        rvl_encoder() : filter(init(), 1) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_rvl_encoder_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    /**
+    * Decodes Z16RVL frames back to Z16 depth frames
+    */
+    class rvl_decoder : public filter
+    {
+    public:
+        rvl_decoder() : filter(init(), 1) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_rvl_decoder_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    /**
+    * A directed acyclic graph of processing blocks, described in JSON. Independent branches of the graph (e.g. align
+    * and pointcloud) are processed concurrently, and the outputs are returned as a single frameset.
+    * See rs2_create_processing_graph for the description format.
+    */
+    class processing_graph : public filter
+    {
+    public:
+        /**
+        * Create a processing graph
+        * \param[in] json_description - JSON description of the graph nodes and outputs
+        */
+        processing_graph(const std::string& json_description) : filter(init(json_description), 1) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init(const std::string& json_description)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_processing_graph(json_description.c_str(), &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
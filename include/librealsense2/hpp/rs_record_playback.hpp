@@ -126,6 +126,65 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Check if playback is reading the file as fast as possible
+        * \return True iff playback is in max throughput mode
+        */
+        bool is_max_throughput() const
+        {
+            rs2_error* e = nullptr;
+            bool max_throughput = rs2_playback_device_is_max_throughput(_dev.get(), &e) != 0;
+            error::handle(e);
+            return max_throughput;
+        }
+
+        /**
+        * Set the playback to read the file as fast as possible, using all cores
+        *
+        * This turns real time mode off, and uses more memory to decompress more of the file ahead of the frames
+        * being played. Setting real time mode back on turns it off.
+        * \param[in] max_throughput  Indicates if max throughput is requested
+        */
+        void set_max_throughput(bool max_throughput) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_max_throughput(_dev.get(), (max_throughput ? 1 : 0), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Read a frame of a stream from the file by its number, without streaming. Frames being played back, if any,
+        * aren't affected. If more than one frame of the stream has the number, the first one is read.
+        * \param[in] profile       A stream profile of the playback device
+        * \param[in] frame_number  The number of the frame to read
+        * \return The frame
+        */
+        frame get_frame(const stream_profile& profile, unsigned long long frame_number) const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame* f = rs2_playback_device_get_frame(_dev.get(), profile.get(), frame_number, &e);
+            error::handle(e);
+            return frame(f);
+        }
+
+        /**
+        * Read the frames of the given streams nearest a time in the file, without streaming. Frames being played back,
+        * if any, aren't affected.
+        * \param[in] time      Time in the file, as for seek()
+        * \param[in] profiles  Stream profiles of the playback device; none for every stream with frames in the file
+        * \return The frameset
+        */
+        frameset get_frames_at(std::chrono::nanoseconds time, const std::vector<stream_profile>& profiles = {}) const
+        {
+            std::vector<const rs2_stream_profile*> raw_profiles;
+            for (auto&& profile : profiles)
+                raw_profiles.push_back(profile.get());
+            rs2_error* e = nullptr;
+            rs2_frame* f = rs2_playback_device_get_frames_at(_dev.get(), raw_profiles.data(), int(raw_profiles.size()), time.count(), &e);
+            error::handle(e);
+            return frameset(frame(f));
+        }
+
         /**
         * Set the playing speed
         * \param[in] speed  Indicates a multiplication of the speed to play (e.g: 1 = normal, 0.5 twice as slow)
@@ -234,6 +293,21 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device to record the given device and save it to the given file as rosbag format
+        * \param[in]  file           The desired path to which the recorder should save the data
+        * \param[in]  device         The device to record
+        * \param[in]  json_settings  A JSON configuration, e.g. {"depth-codec":"rvl"}; see rs2_create_record_device_with_settings
+        */
+        recorder(const std::string& file, rs2::device dev, char const * json_settings)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                rs2_create_record_device_with_settings(dev.get().get(), file.c_str(), json_settings, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
+
 
         /**
         * Pause the recording device without stopping the actual device from streaming.
@@ -255,6 +329,52 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Writes the frames kept before the trigger, for a recorder created with a pre-trigger setting, and everything from now on
+        */
+        void trigger()
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_trigger(_dev.get(), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Gets how many frames of a stream were written since recording started
+        */
+        unsigned long long frames_written(rs2_stream stream, int index = 0) const
+        {
+            rs2_error* e = nullptr;
+            unsigned long long written, dropped;
+            rs2_record_device_get_frame_counts(_dev.get(), stream, index, &written, &dropped, &e);
+            error::handle(e);
+            return written;
+        }
+
+        /**
+        * Gets how many frames of a stream were dropped since recording started, by the queue-policy setting or failing to be written
+        */
+        unsigned long long frames_dropped(rs2_stream stream, int index = 0) const
+        {
+            rs2_error* e = nullptr;
+            unsigned long long written, dropped;
+            rs2_record_device_get_frame_counts(_dev.get(), stream, index, &written, &dropped, &e);
+            error::handle(e);
+            return dropped;
+        }
+
+        /**
+        * Gets the depth of the queue of frames waiting to be written, and their latency
+        */
+        rs2_record_queue_telemetry queue_telemetry() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_queue_telemetry telemetry;
+            rs2_record_device_get_queue_telemetry(_dev.get(), &telemetry, &e);
+            error::handle(e);
+            return telemetry;
+        }
+
         /**
         * Gets the name of the file to which the recorder is writing
         * \return The  name of the file to which the recorder is writing
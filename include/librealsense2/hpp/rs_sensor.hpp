@@ -143,6 +143,26 @@ namespace rs2
             return result;
         }
 
+        /**
+        * Frame memory telemetry of the sensor, as JSON text: frames published and held, publish failures, freelist
+        * size, and bytes allocated and recycled, per frame archive. Cheap enough to poll from a monitoring thread.
+        */
+        std::string get_telemetry() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_sensor_telemetry(_sensor.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         /**
         * open sensor for exclusive access, by committing to composite configuration, specifying one or more stream profiles
         * this method should be used for interdependent  streams, such as depth and infrared, that have to be configured together
@@ -107,6 +107,32 @@ void rs2_reset_logger( rs2_error ** error);
 */
 void rs2_enable_rolling_log_file( unsigned max_size, rs2_error ** error );
 
+/**
+* Start writing a trace of the library's internal threads and hot paths (backend polling, format conversion, syncer,
+* processing blocks, recording) to a file, in Chrome trace-event JSON format (chrome://tracing, Perfetto).
+* Any trace in progress is ended first. Tracing can also be enabled for the whole process by setting the
+* LRS_TRACE_FILE environment variable to the output file name.
+* Fails if the library was built without tracing support (BUILD_WITH_TRACING=OFF).
+* \param[in] file_path  the file to write the trace to; overwritten if it exists
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_start_trace( const char * file_path, rs2_error ** error );
+
+/**
+* End the trace started with rs2_start_trace, writing out all pending events; does nothing if no trace is in progress
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_stop_trace( rs2_error ** error );
+
+/**
+* Move the formatting and writing of the messages logged on the streaming path (per frame) off the streaming threads:
+* they are queued in a preallocated buffer and handed to the log sinks by a background thread. Messages may then be
+* dropped when logged faster than written out; a warning reports how many.
+* \param[in] enable     non-zero to log asynchronously; zero writes out all pending messages and logs synchronously again
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_async_logging( int enable, rs2_error ** error );
+
 
 unsigned rs2_get_log_message_line_number( rs2_log_message const * msg, rs2_error** error );
 const char * rs2_get_log_message_filename( rs2_log_message const * msg, rs2_error** error );
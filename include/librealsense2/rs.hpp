@@ -50,6 +50,35 @@ namespace rs2
         rs2_enable_rolling_log_file( max_size, &e );
         error::handle( e );
     }
+
+    // Start writing a trace of the library's internal threads and hot paths to a file, in Chrome trace-event JSON
+    // format (chrome://tracing, Perfetto). Any trace in progress is ended first.
+    //
+    // @param file_path the file to write the trace to
+    //
+    inline void start_trace( const char * file_path )
+    {
+        rs2_error * e = nullptr;
+        rs2_start_trace( file_path, &e );
+        error::handle( e );
+    }
+
+    // End the trace started with start_trace(), writing out all pending events
+    inline void stop_trace()
+    {
+        rs2_error * e = nullptr;
+        rs2_stop_trace( &e );
+        error::handle( e );
+    }
+
+    // Queue the messages logged on the streaming path for a background thread to write, rather than writing them on
+    // the streaming threads; when disabled again, all pending messages are written out first
+    inline void enable_async_logging( bool enable )
+    {
+        rs2_error * e = nullptr;
+        rs2_enable_async_logging( enable, &e );
+        error::handle( e );
+    }
     
     /*
         Interface to the log message data we expose.
@@ -169,6 +198,7 @@ inline std::ostream & operator << (std::ostream & o, rs2::log_message const & ms
 inline std::ostream & operator << (std::ostream & o, rs2_camera_info camera_info) { return o << rs2_camera_info_to_string(camera_info); }
 inline std::ostream & operator << (std::ostream & o, rs2_frame_metadata_value metadata) { return o << rs2_frame_metadata_to_string(metadata); }
 inline std::ostream & operator << (std::ostream & o, rs2_timestamp_domain domain) { return o << rs2_timestamp_domain_to_string(domain); }
+inline std::ostream & operator << (std::ostream & o, rs2_frame_trace_stage stage) { return o << rs2_frame_trace_stage_to_string(stage); }
 inline std::ostream & operator << (std::ostream & o, rs2_notification_category notificaton) { return o << rs2_notification_category_to_string(notificaton); }
 inline std::ostream & operator << (std::ostream & o, rs2_sr300_visual_preset preset) { return o << rs2_sr300_visual_preset_to_string(preset); }
 inline std::ostream & operator << (std::ostream & o, rs2_exception_type exception_type) { return o << rs2_exception_type_to_string(exception_type); }
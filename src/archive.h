@@ -12,6 +12,18 @@ namespace librealsense
     class frame_interface;
     class sensor_interface;
 
+    // Frame memory counters of an archive, all kept in atomics so they can be read from any thread without locking
+    struct archive_telemetry
+    {
+        uint32_t max_published = 0;     // Frames-queue-size; 0 when unbounded
+        uint32_t published = 0;         // Frames currently held outside the archive
+        uint64_t published_total = 0;
+        uint64_t publish_failures = 0;  // Frames lost because max_published were still held by the user
+        uint64_t freelist_size = 0;     // Released frames kept for reuse
+        uint64_t bytes_allocated = 0;   // Frame buffers that had to be allocated
+        uint64_t bytes_recycled = 0;    // Frame buffers reused from the freelist
+    };
+
     class archive_interface
     {
     public:
@@ -29,6 +41,9 @@ namespace librealsense
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
         virtual void unpublish_frame(frame_interface* frame) = 0;
         virtual void keep_frame(frame_interface* frame) = 0;
+
+        virtual archive_telemetry get_telemetry() const = 0;
+
         virtual ~archive_interface() = default;
     };
 
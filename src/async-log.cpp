@@ -0,0 +1,299 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "async-log.h"
+#include "log.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+namespace librealsense {
+namespace async_log {
+
+
+namespace detail {
+std::atomic< bool > enabled( false );
+}
+
+
+struct record
+{
+    std::atomic< size_t > sequence;
+    rs2_log_severity severity;
+    const char * file;
+    unsigned line;
+    const char * func;
+    char text[MAX_MESSAGE_LENGTH + 1];
+};
+
+
+void fixed_streambuf::reset( char * begin, size_t size )
+{
+    setp( begin, begin + size - 1 );
+}
+
+
+void fixed_streambuf::terminate()
+{
+    if( pbase() )
+        *pptr() = 0;
+}
+
+
+#if BUILD_EASYLOGGINGPP && ! defined( __ANDROID__ )
+
+
+namespace {
+
+
+// Must be a power of 2
+constexpr size_t RING_SIZE = 2048;
+constexpr auto DISPATCH_INTERVAL = std::chrono::milliseconds( 10 );
+
+
+el::Level severity_to_level( rs2_log_severity severity )
+{
+    switch( severity )
+    {
+    case RS2_LOG_SEVERITY_DEBUG: return el::Level::Debug;
+    case RS2_LOG_SEVERITY_INFO: return el::Level::Info;
+    case RS2_LOG_SEVERITY_WARN: return el::Level::Warning;
+    case RS2_LOG_SEVERITY_ERROR: return el::Level::Error;
+    case RS2_LOG_SEVERITY_FATAL: return el::Level::Fatal;
+    default: return el::Level::Unknown;
+    }
+}
+
+
+// A bounded multi-producer queue of records (after Dmitry Vyukov's MPMC queue), with the dispatcher as its single
+// consumer: each record's sequence tells whether it is free for the producer at that position, or ready for the
+// consumer
+class ring
+{
+    std::unique_ptr< record[] > _records;
+    std::atomic< size_t > _enqueue_pos;
+    size_t _dequeue_pos = 0;  // consumer only
+
+public:
+    ring()
+        : _records( new record[RING_SIZE] )
+        , _enqueue_pos( 0 )
+    {
+        for( size_t i = 0; i < RING_SIZE; ++i )
+            _records[i].sequence.store( i, std::memory_order_relaxed );
+    }
+
+    // Returns nullptr when full
+    record * claim()
+    {
+        auto pos = _enqueue_pos.load( std::memory_order_relaxed );
+        while( true )
+        {
+            auto & r = _records[pos & ( RING_SIZE - 1 )];
+            auto seq = r.sequence.load( std::memory_order_acquire );
+            auto diff = static_cast< std::ptrdiff_t >( seq - pos );
+            if( diff == 0 )
+            {
+                if( _enqueue_pos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    return &r;
+            }
+            else if( diff < 0 )
+                return nullptr;
+            else
+                pos = _enqueue_pos.load( std::memory_order_relaxed );
+        }
+    }
+
+    static void publish( record & r )
+    {
+        // Only the claiming thread touches the sequence until it's published
+        r.sequence.store( r.sequence.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+    }
+
+    // Returns the next published record, or nullptr if none is ready yet; must be followed by release()
+    record * front()
+    {
+        auto & r = _records[_dequeue_pos & ( RING_SIZE - 1 )];
+        if( r.sequence.load( std::memory_order_acquire ) != _dequeue_pos + 1 )
+            return nullptr;
+        return &r;
+    }
+
+    void release( record & r )
+    {
+        r.sequence.store( _dequeue_pos + RING_SIZE, std::memory_order_release );
+        ++_dequeue_pos;
+    }
+};
+
+
+class dispatcher
+{
+public:
+    static dispatcher & instance()
+    {
+        // Function-local, so it is destroyed (and flushed) before the easylogging storage it writes to
+        static dispatcher the_dispatcher;
+        return the_dispatcher;
+    }
+
+    void enable( bool enabled )
+    {
+        std::lock_guard< std::mutex > lock( _control_mutex );
+        if( enabled == _thread.joinable() )
+            return;
+
+        if( enabled )
+        {
+            _stopping = false;
+            _thread = std::thread( [this]() { dispatch_loop(); } );
+            detail::enabled = true;
+        }
+        else
+            unsafe_stop();
+    }
+
+    record * claim()
+    {
+        auto r = _ring.claim();
+        if( ! r )
+            _dropped.fetch_add( 1, std::memory_order_relaxed );
+        return r;
+    }
+
+private:
+    dispatcher() = default;
+
+    ~dispatcher()
+    {
+        try
+        {
+            std::lock_guard< std::mutex > lock( _control_mutex );
+            unsafe_stop();
+        }
+        catch( ... )
+        {
+        }
+    }
+
+    void unsafe_stop()
+    {
+        if( ! _thread.joinable() )
+            return;
+
+        detail::enabled = false;
+        {
+            std::lock_guard< std::mutex > lock( _thread_mutex );
+            _stopping = true;
+        }
+        _cv.notify_one();
+        _thread.join();
+
+        // The thread is done: we're the consumer now
+        dispatch_pending();
+    }
+
+    void dispatch_loop()
+    {
+        std::unique_lock< std::mutex > lock( _thread_mutex );
+        while( ! _stopping )
+        {
+            _cv.wait_for( lock, DISPATCH_INTERVAL, [this]() { return _stopping; } );
+            dispatch_pending();
+        }
+    }
+
+    void dispatch_pending()
+    {
+        while( auto r = _ring.front() )
+        {
+            el::base::Writer( severity_to_level( r->severity ), r->file, r->line, r->func )
+                    .construct( 1, LIBREALSENSE_ELPP_ID )
+                << r->text;
+            _ring.release( *r );
+        }
+
+        if( auto dropped = _dropped.exchange( 0 ) )
+            LOG_WARNING( "Asynchronous logging dropped " << dropped << " messages" );
+    }
+
+    ring _ring;
+    std::atomic< size_t > _dropped{ 0 };
+
+    std::mutex _control_mutex;  // enable/disable
+    std::thread _thread;
+    std::mutex _thread_mutex;
+    std::condition_variable _cv;
+    bool _stopping = false;
+};
+
+
+}  // namespace
+
+
+void enable( bool enabled )
+{
+    if( enabled || is_enabled() )  // don't allocate the ring just to disable it
+        dispatcher::instance().enable( enabled );
+}
+
+
+message::message( rs2_log_severity severity, const char * file, unsigned line, const char * func )
+    : _record( dispatcher::instance().claim() )
+    , _stream( &_buf )
+{
+    if( ! _record )
+    {
+        _stream.setstate( std::ios::badbit );
+        return;
+    }
+    _record->severity = severity;
+    _record->file = file;
+    _record->line = line;
+    _record->func = func;
+    _buf.reset( _record->text, sizeof( _record->text ) );
+    // The easylogging %thread would be that of the dispatcher
+    _stream << '[' << std::this_thread::get_id() << "] ";
+}
+
+
+message::~message()
+{
+    if( _record )
+    {
+        _buf.terminate();
+        ring::publish( *_record );
+    }
+}
+
+
+#else  // BUILD_EASYLOGGINGPP && ! __ANDROID__
+
+
+void enable( bool enabled )
+{
+    if( enabled )
+        throw std::runtime_error( "asynchronous logging is not supported without BUILD_EASYLOGGINGPP" );
+}
+
+
+message::message( rs2_log_severity, const char *, unsigned, const char * )
+    : _record( nullptr )
+    , _stream( &_buf )
+{
+    _stream.setstate( std::ios::badbit );
+}
+
+
+message::~message() {}
+
+
+#endif  // BUILD_EASYLOGGINGPP && ! __ANDROID__
+
+
+}  // namespace async_log
+}  // namespace librealsense
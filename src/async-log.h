@@ -0,0 +1,121 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+
+
+namespace librealsense {
+
+
+namespace detail {
+extern std::atomic< int > minimum_log_severity;  // maintained by log.cpp
+}
+
+// Whether any sink (console, file, or callback) takes messages of this severity; lets hot-path statements skip
+// building messages nobody will see
+inline bool is_log_enabled( rs2_log_severity severity )
+{
+    return severity >= detail::minimum_log_severity.load( std::memory_order_relaxed );
+}
+
+
+namespace async_log {
+
+
+// Per-frame log statements (LOG_*_HOT, below) would otherwise format and write their output on the streaming
+// threads, under the easylogging locks. While asynchronous logging is enabled (rs2_enable_async_logging), they are
+// instead formatted into a slot of a fixed-sized ring buffer, allocated once, and a background thread hands them to
+// the regular sinks (console, file, callbacks). When the ring is full, messages are dropped and their number is
+// reported by a warning once there's room again.
+//
+// Messages keep the file, line, and function of the call site, and are prefixed with the ID of the thread that logged
+// them; their easylogging timestamp is that of the background thread, which dispatches every few milliseconds.
+
+
+// Text beyond this length is truncated
+constexpr size_t MAX_MESSAGE_LENGTH = 256;
+
+
+// Starts/stops the background thread; stopping dispatches all pending messages first
+void enable( bool enabled );
+
+namespace detail {
+extern std::atomic< bool > enabled;
+}
+
+inline bool is_enabled() { return detail::enabled.load( std::memory_order_relaxed ); }
+
+
+// A std::streambuf writing into a fixed-sized buffer; anything beyond its end is discarded
+class fixed_streambuf : public std::streambuf
+{
+public:
+    fixed_streambuf() = default;
+    void reset( char * begin, size_t size );  // leaves room for the terminating null
+    void terminate();                          // null-terminates what was written so far
+};
+
+
+struct record;
+
+
+// A single asynchronous log message, formatted through stream() and queued upon destruction:
+//     async_log::message msg( RS2_LOG_SEVERITY_DEBUG, __FILE__, __LINE__, ELPP_FUNC );
+//     msg.stream() << "frame #" << number;
+// If the ring buffer is full the stream is in a failed state, so no formatting takes place.
+// The file and function must be string literals, as they're kept by pointer.
+class message
+{
+    record * _record;
+    fixed_streambuf _buf;
+    std::ostream _stream;
+
+public:
+    message( rs2_log_severity severity, const char * file, unsigned line, const char * func );
+    message( message const & ) = delete;
+    message & operator=( message const & ) = delete;
+    ~message();
+
+    std::ostream & stream() { return _stream; }
+};
+
+
+}  // namespace async_log
+}  // namespace librealsense
+
+
+// Variants of LOG_* for statements on the streaming path (per frame or per callback). They cost a single atomic load
+// when no sink takes their severity and, while asynchronous logging is enabled (rs2_enable_async_logging), are
+// formatted into a preallocated buffer and written out by a background thread.
+// NOTE: only the log configuration done through the rs2_log_* APIs is considered
+#if BUILD_EASYLOGGINGPP && ! defined( __ANDROID__ )
+#define LOG_HOT( SEVERITY, LEVEL, ... )                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if( librealsense::is_log_enabled( SEVERITY ) )                                                                 \
+        {                                                                                                              \
+            if( librealsense::async_log::is_enabled() )                                                                \
+            {                                                                                                          \
+                librealsense::async_log::message _lrs_async_msg( SEVERITY, __FILE__, __LINE__, ELPP_FUNC );            \
+                _lrs_async_msg.stream() << __VA_ARGS__;                                                                \
+            }                                                                                                          \
+            else                                                                                                       \
+                CLOG( LEVEL, LIBREALSENSE_ELPP_ID ) << __VA_ARGS__;                                                    \
+        }                                                                                                              \
+    }                                                                                                                  \
+    while( false )
+#define LOG_DEBUG_HOT(...)   LOG_HOT( RS2_LOG_SEVERITY_DEBUG, DEBUG, __VA_ARGS__ )
+#define LOG_INFO_HOT(...)    LOG_HOT( RS2_LOG_SEVERITY_INFO, INFO, __VA_ARGS__ )
+#define LOG_WARNING_HOT(...) LOG_HOT( RS2_LOG_SEVERITY_WARN, WARNING, __VA_ARGS__ )
+#else
+#define LOG_DEBUG_HOT(...)   LOG_DEBUG( __VA_ARGS__ )
+#define LOG_INFO_HOT(...)    LOG_INFO( __VA_ARGS__ )
+#define LOG_WARNING_HOT(...) LOG_WARNING( __VA_ARGS__ )
+#endif
@@ -33,6 +33,17 @@ public:
 
     virtual bool is_gyro_high_sensitivity() const { return false; }
 
+    // Each sensor has a node of its own with the V4L2 and WMF backends; the user-space USB backends (libuvc, WinUSB)
+    // drive all the sensors through a single device handle
+    bool supports_parallel_sensor_open() const override
+    {
+#if defined( RS2_USE_V4L2_BACKEND ) || defined( RS2_USE_WMF_BACKEND )
+        return true;
+#else
+        return false;
+#endif
+    }
+
 protected:
     uint16_t _pid = 0;
 };
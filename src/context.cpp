@@ -9,6 +9,7 @@
 #include "dds/rsdds-device-factory.h"
 #endif
 #include "rscore-pp-block-factory.h"
+#include "tracing.h"
 
 #include <librealsense2/hpp/rs_types.hpp>  // rs2_devices_changed_callback
 #include <librealsense2/rs.h>              // RS2_API_FULL_VERSION_STR
@@ -54,6 +55,9 @@ namespace librealsense {
             version_logged = true;
             LOG_DEBUG( "Librealsense VERSION: " << RS2_API_FULL_VERSION_STR );
         }
+#ifdef BUILD_WITH_TRACING
+        tracing::start_from_environment();
+#endif
     }
 
 
@@ -70,6 +70,10 @@ public:
 
     virtual bool contradicts( const stream_profile_interface * a,
                               const std::vector< stream_profile > & others ) const = 0;
+
+    // Return true if the sensors of this device may be opened concurrently, from different threads
+    //
+    virtual bool supports_parallel_sensor_open() const { return false; }
 };
 
 
@@ -3,10 +3,12 @@
 #pragma once
 
 #include "frame-header.h"
+#include "frame-trace.h"
 
 #include <map>
 #include <memory>
 #include <array>
+#include <algorithm>
 #include <cstring>  // memcpy
 
 
@@ -50,11 +52,15 @@ static_assert( sizeof( metadata_array_value ) == sizeof( rs2_metadata_type ) + 1
                "unexpected size for metadata array members" );
 
 
+// The metadata payload: only its first metadata_size bytes are used, the rest always being zero
+typedef std::array< uint8_t, sizeof( metadata_array ) > metadata_blob_type;
+
+
 struct frame_additional_data : frame_header
 {
     uint32_t metadata_size = 0;
     bool fisheye_ae_mode = false;  // TODO: remove in future release
-    std::array< uint8_t, sizeof( metadata_array ) > metadata_blob = {};
+    metadata_blob_type metadata_blob = {};
     rs2_time_t last_timestamp = 0;
     unsigned long long last_frame_number = 0;
     bool is_blocking = false;  // when running from recording, this bit indicates
@@ -66,8 +72,40 @@ struct frame_additional_data : frame_header
 
     uint32_t raw_size = 0;  // The frame transmitted size (payload only)
 
+    frame_trace trace;  // Hops of the frame through the library, when frame tracing is enabled
+
     frame_additional_data() {}
 
+    // Frames are moved around a lot (e.g., when published): only the used part of the metadata blob is copied
+    frame_additional_data( frame_additional_data const & other )
+        : frame_header( other )
+        , fisheye_ae_mode( other.fisheye_ae_mode )
+        , last_timestamp( other.last_timestamp )
+        , last_frame_number( other.last_frame_number )
+        , is_blocking( other.is_blocking )
+        , depth_units( other.depth_units )
+        , raw_size( other.raw_size )
+        , trace( other.trace )
+    {
+        copy_metadata( other );
+    }
+
+    frame_additional_data & operator=( frame_additional_data const & other )
+    {
+        if( this == &other )
+            return *this;
+        frame_header::operator=( other );
+        fisheye_ae_mode = other.fisheye_ae_mode;
+        last_timestamp = other.last_timestamp;
+        last_frame_number = other.last_frame_number;
+        is_blocking = other.is_blocking;
+        depth_units = other.depth_units;
+        raw_size = other.raw_size;
+        trace = other.trace;
+        copy_metadata( other );
+        return *this;
+    }
+
     frame_additional_data( metadata_array const & metadata )
     {
         metadata_size = (uint32_t)sizeof( metadata );
@@ -94,7 +132,21 @@ struct frame_additional_data : frame_header
         , raw_size( transmitted_size )
     {
         if( metadata_size )
-            std::copy( md_buf, md_buf + std::min( size_t( md_size ), metadata_blob.size() ), metadata_blob.begin() );
+        {
+            metadata_size = (uint32_t)std::min( size_t( md_size ), metadata_blob.size() );
+            std::copy( md_buf, md_buf + metadata_size, metadata_blob.begin() );
+        }
+    }
+
+private:
+    void copy_metadata( frame_additional_data const & other )
+    {
+        auto const size = std::min( size_t( other.metadata_size ), metadata_blob.size() );
+        std::memcpy( metadata_blob.data(), other.metadata_blob.data(), size );
+        // Clear whatever is left of our previous payload
+        if( metadata_size > size )
+            std::memset( metadata_blob.data() + size, 0, std::min( size_t( metadata_size ), metadata_blob.size() ) - size );
+        metadata_size = uint32_t( size );
     }
 };
 
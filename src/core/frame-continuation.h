@@ -3,6 +3,7 @@
 #pragma once
 
 #include <functional>
+#include <cstddef>
 
 
 namespace librealsense {
@@ -12,6 +13,7 @@ class frame_continuation
 {
     std::function< void() > continuation;
     const void * protected_data = nullptr;
+    size_t protected_size = 0;  // 0 if the frame's own data holds the size
 
     frame_continuation( const frame_continuation & ) = delete;
     frame_continuation & operator=( const frame_continuation & ) = delete;
@@ -22,9 +24,10 @@ public:
     {
     }
 
-    explicit frame_continuation( std::function< void() > continuation, const void * protected_data )
+    explicit frame_continuation( std::function< void() > continuation, const void * protected_data, size_t protected_size = 0 )
         : continuation( continuation )
         , protected_data( protected_data )
+        , protected_size( protected_size )
     {
     }
 
@@ -32,10 +35,12 @@ public:
     frame_continuation( frame_continuation && other )
         : continuation( std::move( other.continuation ) )
         , protected_data( other.protected_data )
+        , protected_size( other.protected_size )
     {
         other.continuation = []() {
         };
         other.protected_data = nullptr;
+        other.protected_size = 0;
     }
 
     void operator()()
@@ -44,25 +49,30 @@ public:
         continuation = []() {
         };
         protected_data = nullptr;
+        protected_size = 0;
     }
 
     void reset()
     {
         protected_data = nullptr;
+        protected_size = 0;
         continuation = []() {
         };
     }
 
     const void * get_data() const { return protected_data; }
+    size_t get_size() const { return protected_size; }
 
     frame_continuation & operator=( frame_continuation && other )
     {
         continuation();
         protected_data = other.protected_data;
+        protected_size = other.protected_size;
         continuation = other.continuation;
         other.continuation = []() {
         };
         other.protected_data = nullptr;
+        other.protected_size = 0;
         return *this;
     }
 
@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <librealsense2/h/rs_frame.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+/*
+    Decoded metadata values of a frame, so each is run through its metadata parsers only once no matter how many
+    times it is queried. Entries are decoded lazily: a 'decoded' bitmap says which values were looked up, and a 'valid'
+    bitmap which of those the frame actually has.
+    Thread-safe for concurrent lookups. It is never copied along with the frame it belongs to, and must be reset
+    whenever the frame's content changes (i.e., when it is reused for another frame).
+*/
+class frame_metadata_cache
+{
+public:
+    static constexpr size_t SIZE = RS2_FRAME_METADATA_COUNT;
+
+    frame_metadata_cache() { reset(); }
+    frame_metadata_cache( frame_metadata_cache const & ) { reset(); }
+    frame_metadata_cache & operator=( frame_metadata_cache const & )
+    {
+        reset();
+        return *this;
+    }
+
+    // Not thread-safe: the frame must not be accessible to others while reset
+    void reset()
+    {
+        for( auto & word : _decoded )
+            word.store( 0, std::memory_order_relaxed );
+        for( auto & word : _valid )
+            word.store( 0, std::memory_order_relaxed );
+    }
+
+    // Returns false if the value was not yet decoded; otherwise whether it's valid and, if so, its value
+    bool get( rs2_frame_metadata_value key, bool & is_valid, rs2_metadata_type & value ) const
+    {
+        auto const bit = mask( key );
+        if( ! ( _decoded[word( key )].load( std::memory_order_acquire ) & bit ) )
+            return false;
+        is_valid = ( _valid[word( key )].load( std::memory_order_relaxed ) & bit ) != 0;
+        if( is_valid )
+            value = _values[key].load( std::memory_order_relaxed );
+        return true;
+    }
+
+    void set( rs2_frame_metadata_value key, bool is_valid, rs2_metadata_type value )
+    {
+        auto const bit = mask( key );
+        if( is_valid )
+        {
+            _values[key].store( value, std::memory_order_relaxed );
+            _valid[word( key )].fetch_or( bit, std::memory_order_relaxed );
+        }
+        // Publishes the above
+        _decoded[word( key )].fetch_or( bit, std::memory_order_release );
+    }
+
+    static bool is_cached( rs2_frame_metadata_value key ) { return key >= 0 && size_t( key ) < SIZE; }
+
+private:
+    static size_t word( rs2_frame_metadata_value key ) { return size_t( key ) / 64; }
+    static uint64_t mask( rs2_frame_metadata_value key ) { return uint64_t( 1 ) << ( size_t( key ) % 64 ); }
+
+    static constexpr size_t WORDS = ( SIZE + 63 ) / 64;
+    std::array< std::atomic< uint64_t >, WORDS > _decoded;
+    std::array< std::atomic< uint64_t >, WORDS > _valid;
+    std::array< std::atomic< rs2_metadata_type >, SIZE > _values;
+};
+
+
+}  // namespace librealsense
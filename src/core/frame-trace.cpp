@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "frame-trace.h"
+
+#include <chrono>
+#include <thread>
+
+
+namespace librealsense {
+
+
+std::atomic< bool > frame_trace::_enabled( false );
+
+
+rs2_time_t frame_trace::now()
+{
+    return std::chrono::duration< rs2_time_t, std::milli >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+void frame_trace::lock() const
+{
+    while( _lock.test_and_set( std::memory_order_acquire ) )
+        std::this_thread::yield();
+}
+
+
+frame_trace & frame_trace::operator=( frame_trace const & other )
+{
+    if( this == &other )
+        return *this;
+
+    // Frame headers are copied around a lot; most of them have nothing to copy
+    if( ! is_enabled() || ! other._size.load( std::memory_order_relaxed ) )
+    {
+        _size.store( 0, std::memory_order_relaxed );
+        return *this;
+    }
+
+    other.lock();
+    auto const size = other._size.load( std::memory_order_relaxed );
+    auto const events = other._events;
+    other.unlock();
+
+    lock();
+    _events = events;
+    _size.store( size, std::memory_order_relaxed );
+    unlock();
+    return *this;
+}
+
+
+void frame_trace::add( rs2_frame_trace_stage stage, rs2_time_t time )
+{
+    lock();
+    auto const size = _size.load( std::memory_order_relaxed );
+    if( size < MAX_EVENTS )
+    {
+        _events[size] = { stage, time };
+        _size.store( size + 1, std::memory_order_relaxed );
+    }
+    unlock();
+}
+
+
+size_t frame_trace::size() const
+{
+    return _size.load( std::memory_order_relaxed );
+}
+
+
+frame_trace::event frame_trace::get( size_t index ) const
+{
+    lock();
+    auto const e = index < _size.load( std::memory_order_relaxed ) ? _events[index] : event{ RS2_FRAME_TRACE_STAGE_COUNT, 0 };
+    unlock();
+    return e;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <librealsense2/h/rs_frame.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+/*
+    Monotonic timestamps of the hops a frame went through on its way to the application (see
+    rs2_enable_frame_trace). Fixed-sized, so it can be part of the frame header without per-frame allocations.
+    Events are appended only while tracing is enabled; once MAX_EVENTS were recorded, further ones are dropped.
+*/
+class frame_trace
+{
+public:
+    static constexpr size_t MAX_EVENTS = 16;
+
+    struct event
+    {
+        rs2_frame_trace_stage stage;
+        rs2_time_t time;  // milliseconds, steady clock
+    };
+
+    frame_trace() = default;
+    frame_trace( frame_trace const & other ) { *this = other; }
+    frame_trace & operator=( frame_trace const & other );
+
+    static bool is_enabled() { return _enabled.load( std::memory_order_relaxed ); }
+    static void enable( bool enabled ) { _enabled = enabled; }
+    static rs2_time_t now();
+
+    // Thread-safe: a frame may pass several hops concurrently, e.g. when it is shared by two consumers
+    void add( rs2_frame_trace_stage stage, rs2_time_t time = now() );
+
+    size_t size() const;
+    event get( size_t index ) const;
+
+private:
+    void lock() const;
+    void unlock() const { _lock.clear( std::memory_order_release ); }
+
+    mutable std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+    std::atomic< uint32_t > _size{ 0 };  // written under the lock; read without it to skip empty traces
+    std::array< event, MAX_EVENTS > _events;
+
+    static std::atomic< bool > _enabled;
+};
+
+
+}  // namespace librealsense
@@ -352,6 +352,12 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            // Reading as fast as possible, trading memory for more of the file being read ahead on all cores
+            virtual void set_max_throughput(bool max_throughput) = 0;
+            // Random access to the frames of a stream, enabled or not and without disturbing the frames being read:
+            // the frame with the given number, or the one nearest the given time; null if the file has no such frame
+            virtual std::shared_ptr<serialized_frame> read_frame(const stream_identifier& stream_id, unsigned long long frame_number) = 0;
+            virtual std::shared_ptr<serialized_frame> read_frame_at(const stream_identifier& stream_id, const nanoseconds& time) = 0;
         };
     }
 }
@@ -426,6 +426,8 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
                 // (all metadata is not there when we create the frame, so no need to erase)
             }
         }
+        f->additional_data.metadata_size = sizeof( metadata );
+        f->reset_metadata_cache();
     }
 }
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "async-log.h"
 #include <src/core/frame-interface.h>
 
 #include <atomic>
@@ -24,6 +25,12 @@ namespace librealsense
 
         std::vector<T> freelist; // return frames here
         std::atomic<bool> recycle_frames;
+        // Telemetry
+        std::atomic< uint64_t > published_total{ 0 };
+        std::atomic< uint64_t > publish_failures{ 0 };
+        std::atomic< uint64_t > freelist_size{ 0 };
+        std::atomic< uint64_t > bytes_allocated{ 0 };
+        std::atomic< uint64_t > bytes_recycled{ 0 };
         int pending_frames = 0;
         std::recursive_mutex mutex;
 
@@ -34,6 +41,7 @@ namespace librealsense
         T alloc_frame(const size_t size, frame_additional_data && additional_data, bool requires_memory)
         {
             T backbuffer;
+            bool recycled = false;
             //const size_t size = modes[stream].get_image_size(stream);
             {
                 std::lock_guard<std::recursive_mutex> guard(mutex);
@@ -47,6 +55,7 @@ namespace librealsense
                         {
                             backbuffer = std::move(*it);
                             freelist.erase(it);
+                            recycled = true;
                             break;
                         }
                     }
@@ -58,11 +67,13 @@ namespace librealsense
                     if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
                     else ++it;
                 }
+                freelist_size = freelist.size();
             }
 
             if (requires_memory)
             {
                 backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                ( recycled ? bytes_recycled : bytes_allocated ) += size;
             }
             backbuffer.additional_data = std::move( additional_data );
             return backbuffer;
@@ -79,7 +90,7 @@ namespace librealsense
                 return published_frame;
             }
 
-            LOG_DEBUG("publish(...) failed");
+            LOG_DEBUG_HOT("publish(...) failed");
             return nullptr;
         }
 
@@ -95,6 +106,7 @@ namespace librealsense
                 if (recycle_frames)
                 {
                     freelist.push_back(std::move(*f));
+                    freelist_size = freelist.size();
                 }
                 lock.unlock();
 
@@ -119,7 +131,8 @@ namespace librealsense
             if (published_frames_count >= max_frames
                 && max_frames)
             {
-                LOG_DEBUG("User didn't release frame resource.");
+                ++publish_failures;
+                LOG_DEBUG_HOT("User didn't release frame resource.");
                 return nullptr;
             }
             auto new_frame = (max_frames ? published_frames.allocate() : new T());
@@ -135,6 +148,7 @@ namespace librealsense
             }
 
             ++published_frames_count;
+            ++published_total;
             *new_frame = std::move(*f);
 
             return new_frame;
@@ -154,6 +168,19 @@ namespace librealsense
             published_frames_count = 0;
         }
 
+        archive_telemetry get_telemetry() const override
+        {
+            archive_telemetry t;
+            t.max_published = *max_frame_queue_size;
+            t.published = published_frames_count;
+            t.published_total = published_total;
+            t.publish_failures = publish_failures;
+            t.freelist_size = freelist_size;
+            t.bytes_allocated = bytes_allocated;
+            t.bytes_recycled = bytes_recycled;
+            return t;
+        }
+
         callback_invocation_holder begin_callback() override
         {
             return { callback_inflight.allocate(), &callback_inflight };
@@ -187,6 +214,7 @@ namespace librealsense
             {
                 std::lock_guard<std::recursive_mutex> guard(mutex);
                 freelist.clear();
+                freelist_size = 0;
             }
 
             pending_frames = published_frames.get_size();
@@ -7,6 +7,7 @@
 #include "archive.h"
 #include "metadata-parser.h"
 #include "core/enum-helpers.h"
+#include "core/time-service.h"
 
 #include <rsutils/string/from.h>
 
@@ -79,6 +80,7 @@ frame & frame::operator=( frame && r )
     _kept = r._kept.exchange( false );
     on_release = std::move( r.on_release );
     additional_data = std::move( r.additional_data );
+    _metadata_cache.reset();
     r.owner.reset();
     if( owner )
         metadata_parsers = owner->get_md_parsers();
@@ -137,18 +139,39 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 {
     if( ! metadata_parsers )
         return false;
-    auto parsers = metadata_parsers->equal_range( frame_metadata );
 
+    bool const cached = frame_metadata_cache::is_cached( frame_metadata );
+    if( cached )
+    {
+        bool is_valid;
+        rs2_metadata_type value;
+        if( _metadata_cache.get( frame_metadata, is_valid, value ) )
+        {
+            if( is_valid && p_value )
+                *p_value = value;
+            return is_valid;
+        }
+    }
+
+    // Decode it: the last parser to find it wins
+    auto parsers = metadata_parsers->equal_range( frame_metadata );
     bool value_retrieved = false;
+    rs2_metadata_type value = 0;
     for( auto it = parsers.first; it != parsers.second; ++it )
-        if( it->second->find( *this, p_value ) )
+        if( it->second->find( *this, &value ) )
             value_retrieved = true;
 
+    if( cached )
+        _metadata_cache.set( frame_metadata, value_retrieved, value );
+    if( value_retrieved && p_value )
+        *p_value = value;
     return value_retrieved;
 }
 
 int frame::get_frame_data_size() const
 {
+    if( on_release.get_data() && on_release.get_size() )
+        return (int)on_release.get_size();
     return (int)data.size();
 }
 
@@ -227,4 +250,32 @@ float depth_frame::get_distance( int x, int y ) const
 }
 
 
+void trace_frame( frame_interface * f, rs2_frame_trace_stage stage )
+{
+    if( ! frame_trace::is_enabled() || ! f )
+        return;
+
+    auto const now = frame_trace::now();
+    auto add = [&]( frame * single )
+    {
+        auto & data = single->additional_data;
+        auto time = now;
+        // A frame arrives when the backend got it, not when the sensor got around to it. The backend time is on the
+        // system clock: its age is taken off the steady clock.
+        if( stage == RS2_FRAME_TRACE_STAGE_ARRIVAL && data.backend_timestamp > 0 )
+            time -= std::max( 0., time_service::get_time() - data.backend_timestamp );
+        data.trace.add( stage, time );
+    };
+    if( auto composite = dynamic_cast< composite_frame * >( f ) )
+    {
+        auto frames = composite->get_frames();
+        for( size_t i = 0; i < composite->get_embedded_frames_count(); i++ )
+            if( auto child = dynamic_cast< frame * >( frames[i] ) )
+                add( child );
+    }
+    else if( auto single = dynamic_cast< frame * >( f ) )
+        add( single );
+}
+
+
 }  // namespace librealsense
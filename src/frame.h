@@ -6,6 +6,7 @@
 #include "core/frame-interface.h"
 #include "core/frame-continuation.h"
 #include "core/frame-additional-data.h"
+#include "core/frame-metadata-cache.h"
 #include "basics.h"
 #include <atomic>
 #include <vector>
@@ -43,13 +44,21 @@ public:
     const uint8_t * get_frame_data() const override;
     rs2_time_t get_frame_timestamp() const override;
     rs2_timestamp_domain get_frame_timestamp_domain() const override;
-    void set_timestamp( double new_ts ) override { additional_data.timestamp = new_ts; }
+    void set_timestamp( double new_ts ) override
+    {
+        additional_data.timestamp = new_ts;
+        _metadata_cache.reset();  // metadata may be derived from the timestamp
+    }
     unsigned long long get_frame_number() const override;
     void set_timestamp_domain( rs2_timestamp_domain timestamp_domain ) override
     {
         additional_data.timestamp_domain = timestamp_domain;
+        _metadata_cache.reset();
     }
 
+    // Must be called when metadata_blob is written to after the frame was allocated
+    void reset_metadata_cache() { _metadata_cache.reset(); }
+
     // Return FPS calculated as (1000*d_frames/d_timestamp), or 0 if this cannot be estimated
     double calc_actual_fps() const;
 
@@ -63,6 +72,10 @@ public:
 
     void acquire() override { ref_count.fetch_add( 1 ); }
     void release() override;
+    // True when only one reference to the frame exists, so that its holder may modify the frame in place
+    bool is_exclusive() const { return ref_count.load() == 1; }
+    // False when the frame data is borrowed, e.g. a software-device frame pointing at the caller's buffer
+    bool owns_data() const { return ! on_release.get_data(); }
     void keep() override;
 
     frame_interface * publish( std::shared_ptr< archive_interface > new_owner ) override;
@@ -94,7 +107,12 @@ private:
     bool _fixed = false;
     std::atomic_bool _kept;
     std::shared_ptr< stream_profile_interface > stream;
+    mutable frame_metadata_cache _metadata_cache;  // values decoded by find_metadata
 };
 
 
+// Records a trace event on the frame, and on every frame of a composite, while frame tracing is enabled
+void trace_frame( frame_interface * f, rs2_frame_trace_stage stage );
+
+
 }  // namespace librealsense
@@ -8,6 +8,7 @@
 #include "metadata.h"
 #include "platform/stream-profile-impl.h"
 #include "fourcc.h"
+#include "async-log.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
 
@@ -231,7 +232,7 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
             const auto && bpp = get_image_bpp( request->get_format() );
             auto && data_size = sensor_data.fo.frame_size;
 
-            LOG_DEBUG( "FrameAccepted," << get_string( request->get_stream_type() ) << ",Counter," << std::dec
+            LOG_DEBUG_HOT( "FrameAccepted," << get_string( request->get_stream_type() ) << ",Counter," << std::dec
                                         << frame_counter << ",Index,0"
                                         << ",BackEndTS," << std::fixed << sensor_data.fo.backend_time << ",SystemTime,"
                                         << std::fixed << system_time << " ,diff_ts[Sys-BE],"
@@ -257,6 +258,7 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
             }
             frame->set_stream( request );
             frame->set_timestamp_domain( timestamp_domain );
+            trace_frame( frame.frame, RS2_FRAME_TRACE_STAGE_ARRIVAL );
 
             // Gather info for logging the callback ended
             auto fps = frame->get_stream()->get_framerate();
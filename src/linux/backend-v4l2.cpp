@@ -6,6 +6,7 @@
 #include <src/platform/hid-data.h>
 #include <src/core/time-service.h>
 #include <src/core/notification.h>
+#include <src/tracing.h>
 #include "backend-hid.h"
 #include "backend.h"
 #include "types.h"
@@ -1435,6 +1436,7 @@ namespace librealsense
                     }
                     else // Check and acquire data buffers from kernel
                     {
+                        LRS_TRACE_SCOPE( "v4l2 acquire buffers" );
                         bool md_extracted = false;
                         bool keep_md = false;
                         bool wa_applied = false;
@@ -2,6 +2,7 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 
 #include "log.h"
+#include "async-log.h"
 
 
 #ifdef BUILD_EASYLOGGINGPP
@@ -11,26 +12,31 @@ namespace librealsense
 {
     char log_name[] = LIBREALSENSE_ELPP_ID;
     static logger_type<log_name> logger;
+    std::atomic< int > detail::minimum_log_severity( logger.get_minimum_severity() );
 }
 
 void librealsense::log_to_console(rs2_log_severity min_severity)
 {
     logger.log_to_console(min_severity);
+    detail::minimum_log_severity = logger.get_minimum_severity();
 }
 
 void librealsense::log_to_file(rs2_log_severity min_severity, const char * file_path)
 {
     logger.log_to_file(min_severity, file_path);
+    detail::minimum_log_severity = logger.get_minimum_severity();
 }
 
 void librealsense::log_to_callback( rs2_log_severity min_severity, rs2_log_callback_sptr callback )
 {
     logger.log_to_callback( min_severity, callback );
+    detail::minimum_log_severity = logger.get_minimum_severity();
 }
 
 void librealsense::reset_logger()
 {
     logger.reset_logger();
+    detail::minimum_log_severity = logger.get_minimum_severity();
 }
 
 void librealsense::enable_rolling_log_file( unsigned max_size )
@@ -40,6 +46,8 @@ void librealsense::enable_rolling_log_file( unsigned max_size )
 
 #else // BUILD_EASYLOGGINGPP
 
+std::atomic< int > librealsense::detail::minimum_log_severity( RS2_LOG_SEVERITY_NONE );
+
 void librealsense::log_to_console(rs2_log_severity min_severity)
 {
     throw std::runtime_error("log_to_console is not supported without BUILD_EASYLOGGINGPP");
@@ -12,6 +12,7 @@
 #include <stdexcept>
 #include <mutex>
 #include <fstream>
+#include <algorithm>
 
 
 namespace librealsense
@@ -58,6 +59,7 @@ namespace librealsense
         rs2_log_severity minimum_log_severity = RS2_LOG_SEVERITY_NONE;
         rs2_log_severity minimum_console_severity = RS2_LOG_SEVERITY_NONE;
         rs2_log_severity minimum_file_severity = RS2_LOG_SEVERITY_NONE;
+        rs2_log_severity minimum_callback_severity = RS2_LOG_SEVERITY_NONE;
 
         std::mutex log_mutex;
         std::ofstream log_file;
@@ -159,6 +161,12 @@ namespace librealsense
             }
         }
 
+        // The lowest severity logged by any of the sinks
+        rs2_log_severity get_minimum_severity() const
+        {
+            return std::min( { minimum_console_severity, minimum_file_severity, minimum_callback_severity } );
+        }
+
         static bool try_get_log_severity(rs2_log_severity& severity)
         {
             static const char* severity_var_name = "LRS_LOG_LEVEL";
@@ -255,6 +263,7 @@ namespace librealsense
                 auto dispatcher = el::Helpers::logDispatchCallback< elpp_dispatcher >( dispatch_name );
                 dispatcher->callback = callback;
                 dispatcher->min_severity = min_severity;
+                minimum_callback_severity = std::min( minimum_callback_severity, min_severity );
                 
                 // Remove the default logger (which will log to standard out/err) or it'll still be active
                 //el::Helpers::uninstallLogDispatchCallback< el::base::DefaultLogDispatchCallback >( "DefaultLogDispatchCallback" );
@@ -272,6 +281,7 @@ namespace librealsense
             minimum_log_severity = RS2_LOG_SEVERITY_NONE;
             minimum_console_severity = RS2_LOG_SEVERITY_NONE;
             minimum_file_severity = RS2_LOG_SEVERITY_NONE;
+            minimum_callback_severity = RS2_LOG_SEVERITY_NONE;
         }
 
         // Callback: called by EL++ when the current log file has reached a certain maximum size.
@@ -7,8 +7,10 @@
 #include "core/motion.h"
 #include "stream.h"
 #include "media/ros/ros_reader.h"
+#include "media/raw/raw_reader.h"
 #include "environment.h"
 #include "sync.h"
+#include "proc/synthetic-stream.h"
 #include <src/depth-sensor.h>
 #include <src/color-sensor.h>
 #include <src/pose.h>
@@ -25,9 +27,23 @@ static bool is_video_stream( rs2_stream stream )
 
 std::shared_ptr< device_interface > playback_device_info::create_device()
 {
-    auto playback_dev
-        = std::make_shared< playback_device >( shared_from_this(),
-                                               std::make_shared< ros_reader >( _filename, get_context() ) );
+    // The bag is opened once, whether or not its video frames are in a frames file next to it
+    auto bag = std::make_shared< ros_reader >( _filename, get_context() );
+    std::shared_ptr< device_serializer::reader > reader = bag;
+    if( raw_reader::is_raw( *bag ) )
+    {
+        try
+        {
+            reader = std::make_shared< raw_reader >( bag );
+        }
+        catch( const std::exception & e )
+        {
+            // E.g., the recording didn't end properly and the frames file has no index: what's in the bag can still
+            // be played
+            LOG_WARNING( "Playing " << _filename << " without its video frames: " << e.what() );
+        }
+    }
+    auto playback_dev = std::make_shared< playback_device >( shared_from_this(), reader );
     return playback_dev;
 }
 
@@ -39,8 +55,10 @@ playback_device::playback_device( std::shared_ptr< const device_info > const & d
     , m_is_paused( false )
     , m_sample_rate( 1 )
     , m_real_time( true )
+    , m_max_throughput( false )
     , m_prev_timestamp( 0 )
     , m_last_published_timestamp( 0 )
+    , m_framesets_source( std::make_shared< frame_source >() )
 {
     if (serializer == nullptr)
     {
@@ -48,6 +66,7 @@ playback_device::playback_device( std::shared_ptr< const device_info > const & d
     }
 
     m_reader = serializer;
+    m_framesets_source->init( std::make_shared< metadata_parser_map >() );
     (*m_read_thread)->start();
 
     //Read header and build device from recorded device snapshot
@@ -403,6 +422,8 @@ void playback_device::set_real_time(bool real_time)
 {
     LOG_INFO("Set real time to " << ((real_time) ? "True" : "False"));
     m_real_time = real_time;
+    if (real_time && m_max_throughput)
+        set_max_throughput(false);
 }
 
 bool playback_device::is_real_time() const
@@ -410,6 +431,130 @@ bool playback_device::is_real_time() const
     return m_real_time;
 }
 
+void playback_device::set_max_throughput(bool max_throughput)
+{
+    LOG_INFO("Set max throughput to " << ((max_throughput) ? "True" : "False"));
+    m_max_throughput = max_throughput;
+    if (max_throughput)
+        m_real_time = false;
+    // The reader is only ever used from the read thread
+    (*m_read_thread)->invoke([this, max_throughput](dispatcher::cancellable_timer t)
+    {
+        m_reader->set_max_throughput(max_throughput);
+    });
+}
+
+bool playback_device::is_max_throughput() const
+{
+    return m_max_throughput;
+}
+
+template <typename T>
+T playback_device::read(std::function<T()> action)
+{
+    // The reader is only ever used from the read thread; reading there between the frames being played back.
+    // Should the wait time out, the read still completes later, so everything it uses is owned by it
+    struct read_state
+    {
+        std::function<T()> action;
+        T result;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<read_state>();
+    state->action = std::move(action);
+    (*m_read_thread)->invoke([state](dispatcher::cancellable_timer t)
+    {
+        try
+        {
+            state->result = state->action();
+        }
+        catch (...)
+        {
+            state->error = std::current_exception();
+        }
+    });
+    if ((*m_read_thread)->flush() == false)
+        throw io_exception("Timeout waiting for a frame to be read from the file");
+    if (state->error)
+        std::rethrow_exception(state->error);
+    return std::move(state->result);
+}
+
+device_serializer::stream_identifier playback_device::get_stream_identifier(const stream_interface& stream) const
+{
+    for (auto&& sensor : m_sensors)
+    {
+        for (auto&& profile : sensor.second->get_stream_profiles())
+        {
+            if (profile->get_unique_id() == stream.get_unique_id())
+                return { get_device_index(), sensor.first, profile->get_stream_type(), static_cast<uint32_t>(profile->get_stream_index()) };
+        }
+    }
+    throw invalid_value_exception("Stream is not one of the streams of the file");
+}
+
+frame_holder playback_device::attach_frame(std::shared_ptr<device_serializer::serialized_frame> frame)
+{
+    auto sensor = m_sensors.find(frame->stream_id.sensor_index);
+    if (sensor == m_sensors.end())
+        throw io_exception(rsutils::string::from() << "Unexpected sensor index of frame read from file (Read index = "
+                                                   << frame->stream_id.sensor_index << ")");
+    sensor->second->attach_frame(frame->frame);
+    return std::move(frame->frame);
+}
+
+frame_holder playback_device::get_frame(const stream_interface& stream, unsigned long long frame_number)
+{
+    auto stream_id = get_stream_identifier(stream);
+    auto frame = read<std::shared_ptr<serialized_frame>>([this, stream_id, frame_number]() { return m_reader->read_frame(stream_id, frame_number); });
+    if (!frame)
+        throw invalid_value_exception(rsutils::string::from() << "Frame " << frame_number << " of " << stream_id << " is not in the file");
+    return attach_frame(frame);
+}
+
+frame_holder playback_device::get_frames_at(const std::vector<std::shared_ptr<stream_interface>>& streams, device_serializer::nanoseconds time)
+{
+    if (time.count() < 0 || time > m_reader->query_duration())
+        throw invalid_value_exception(rsutils::string::from() << "Requested time is out of playback length. (Requested = "
+                                                              << time.count() << ", Duration = " << get_duration() << ")");
+    // With no streams given, every stream with frames in the file; streams of different profiles are the same stream
+    std::set<device_serializer::stream_identifier> stream_ids;
+    for (auto&& stream : streams)
+        stream_ids.insert(get_stream_identifier(*stream));
+    bool const all_streams = stream_ids.empty();
+    if (all_streams)
+    {
+        for (auto&& sensor : m_sensors)
+            for (auto&& profile : sensor.second->get_stream_profiles())
+                stream_ids.insert({ get_device_index(), sensor.first, profile->get_stream_type(), static_cast<uint32_t>(profile->get_stream_index()) });
+    }
+
+    auto frames = read<std::vector<std::shared_ptr<serialized_frame>>>([this, stream_ids, all_streams, time]()
+    {
+        std::vector<std::shared_ptr<serialized_frame>> result;
+        for (auto&& stream_id : stream_ids)
+        {
+            auto frame = m_reader->read_frame_at(stream_id, time);
+            if (frame)
+                result.push_back(frame);
+            else if (!all_streams)
+                throw invalid_value_exception(rsutils::string::from() << "There are no frames of " << stream_id << " in the file");
+        }
+        return result;
+    });
+    if (frames.empty())
+        throw invalid_value_exception("There are no frames in the file");
+
+    std::vector<frame_holder> holders;
+    for (auto&& frame : frames)
+        holders.push_back(attach_frame(frame));
+    synthetic_source source(*m_framesets_source);
+    frame_holder frameset(source.allocate_composite_frame(std::move(holders)));
+    if (!frameset)
+        throw io_exception("Failed to allocate a frameset; too many framesets may be held");
+    return frameset;
+}
+
 std::shared_ptr< const device_info > playback_device::get_device_info() const
 {
     return m_device_info;
@@ -44,6 +44,12 @@ namespace librealsense
         void stop();
         void set_real_time(bool real_time);
         bool is_real_time() const;
+        void set_max_throughput(bool max_throughput);
+        bool is_max_throughput() const;
+        // Frames read from the file directly, without streaming: the frame of a stream with the given number, and the
+        // frameset of the frames of the given streams (all if none are given) nearest the given time
+        frame_holder get_frame(const stream_interface& stream, unsigned long long frame_number);
+        frame_holder get_frames_at(const std::vector<std::shared_ptr<stream_interface>>& streams, device_serializer::nanoseconds time);
         const std::string& get_file_name() const;
         uint64_t get_position() const;
         rsutils::public_signal< playback_device, rs2_playback_status > playback_status_changed;
@@ -77,6 +83,9 @@ namespace librealsense
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
         bool prefetch_done();
+        device_serializer::stream_identifier get_stream_identifier(const stream_interface& stream) const;
+        template <typename T> T read(std::function<T()> action);
+        frame_holder attach_frame(std::shared_ptr<device_serializer::serialized_frame> frame);
 
     private:
         rsutils::lazy< std::shared_ptr< dispatcher > > m_read_thread;
@@ -91,12 +100,14 @@ namespace librealsense
         std::map<uint32_t, std::shared_ptr<playback_sensor>> m_active_sensors;
         std::atomic<double> m_sample_rate;
         std::atomic_bool m_real_time;
+        std::atomic_bool m_max_throughput;
         device_serializer::nanoseconds m_prev_timestamp;
         std::vector< std::shared_ptr< rsutils::lazy< rs2_extrinsics > > > m_extrinsics_fetchers;
         std::map<int, std::pair<uint32_t, rs2_extrinsics>> m_extrinsics_map;
         device_serializer::nanoseconds m_last_published_timestamp;
         std::mutex m_last_published_timestamp_mutex;
         std::mutex _active_sensors_mutex;
+        std::shared_ptr<frame_source> m_framesets_source;
     };
 
     MAP_EXTENSION(RS2_EXTENSION_PLAYBACK, playback_device);
@@ -54,6 +54,15 @@ bool playback_sensor::streams_contains_one_frame_or_more()
     return false;
 }
 
+void playback_sensor::attach_frame(frame_holder& frame)
+{
+    frame->get_owner()->set_sensor(shared_from_this());
+    auto type = frame->get_stream()->get_stream_type();
+    auto index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
+    frame->set_stream(m_streams[std::make_pair(type, index)]);
+    frame->set_sensor(shared_from_this());
+}
+
 stream_profiles playback_sensor::get_stream_profiles(int tag) const
 {
     if (tag == profile_tag::PROFILE_TAG_ANY)
@@ -62,6 +62,8 @@ namespace librealsense
         void unregister_before_start_callback(int token) override;
         void raise_notification(const notification& n);
         bool streams_contains_one_frame_or_more();
+        // Makes a frame read from the file one of this sensor's frames, of its stream
+        void attach_frame(frame_holder& frame);
         virtual processing_blocks get_recommended_processing_blocks() const override
         {
             auto processing_blocks_snapshot = m_sensor_description.get_sensor_extensions_snapshots().find(RS2_EXTENSION_RECOMMENDED_FILTERS);
@@ -123,11 +125,7 @@ namespace librealsense
             }
             if (m_is_started)
             {
-                frame->get_owner()->set_sensor(shared_from_this());
-                auto type = frame->get_stream()->get_stream_type();
-                auto index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
-                frame->set_stream(m_streams[std::make_pair(type, index)]);
-                frame->set_sensor(shared_from_this());
+                attach_frame(frame);
                 auto stream_id = frame.frame->get_stream()->get_unique_id();
                 //TODO: Ziv, remove usage of shared_ptr when frame_holder is cpoyable
                 auto pf = std::make_shared<frame_holder>(std::move(frame));
@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <core/serialization.h>
+
+#include <cstdint>
+#include <string>
+
+namespace librealsense
+{
+    /*
+        The raw recording format, for capturing video at rates the bag format can't sustain: video frames are written
+        as is to a frames file next to the bag (<bag>.frames), in large preallocated segments with direct I/O, and
+        everything else (the device description, options, notifications and motion/pose samples) to the bag.
+
+        The frames file:
+        - A header block (file_header, padded to block_size), written when the file is closed
+        - Frame records, back to back: frame_record, then metadata_size bytes of metadata (as in md_constant_parser),
+          then data_size bytes of frame data
+        - The index, from index_offset: a uint32_t count of streams and their stream_entry, then a uint64_t count of
+          frames and their index_entry, in the order they were written
+        Values are in the byte order of the machine that wrote the file; files of another byte order aren't read.
+    */
+    namespace raw_file_format
+    {
+        char const magic[8] = { 'R', 'S', 'R', 'A', 'W', 'F', 'R', 'M' };
+        // As recorded in the bag (ros_topic::frames_format_topic), which decides whether the frames file is read
+        char const * const format_name = "raw";
+        uint32_t const version = 1;
+        uint32_t const byte_order = 0x01020304;
+
+        // Writes are in whole blocks of this size, aligned to it, as direct I/O requires
+        size_t const block_size = 4096;
+
+        inline std::string frames_file_name( const std::string & bag_file ) { return bag_file + ".frames"; }
+
+#pragma pack( push, 1 )
+        struct file_header
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t byte_order;
+            uint64_t index_offset;  // 0 until the file is closed
+            uint64_t index_size;
+        };
+
+        struct stream_entry
+        {
+            uint32_t device_index;
+            uint32_t sensor_index;
+            uint32_t stream_type;
+            uint32_t stream_index;
+        };
+
+        struct index_entry
+        {
+            int64_t time;           // ns, as the bag's
+            uint64_t offset;        // of the frame_record
+            uint32_t stream;        // in the streams of the index
+            uint32_t size;          // of the whole record
+            uint64_t frame_number;
+        };
+
+        struct frame_record
+        {
+            double timestamp;       // ms
+            double system_time;
+            uint64_t frame_number;
+            uint32_t timestamp_domain;
+            uint32_t format;
+            uint32_t width;
+            uint32_t height;
+            uint32_t stride;
+            uint32_t bpp;
+            float depth_units;
+            uint32_t metadata_size;
+            uint64_t data_size;
+        };
+#pragma pack( pop )
+    }
+}
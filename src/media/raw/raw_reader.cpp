@@ -0,0 +1,290 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "raw_reader.h"
+#include <src/core/video-frame.h>
+#include <src/source.h>
+#include <src/stream.h>
+
+#include <rsutils/string/from.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace librealsense
+{
+    using namespace device_serializer;
+
+    raw_reader::raw_reader(const std::shared_ptr<ros_reader>& bag)
+        : m_file_path(bag->get_file_name())
+        , m_bag(bag)
+        , m_next_frame(0)
+        , m_duration(0)
+        , m_metadata_parser_map(md_constant_parser::create_metadata_parser_map())
+    {
+        read_index();
+        m_frame_source = std::make_shared<frame_source>(32);
+        m_frame_source->init(m_metadata_parser_map);
+    }
+
+    bool raw_reader::is_raw(const ros_reader& bag)
+    {
+        // The bag says so; a frames file may be left over from an earlier recording to the same path
+        if (!std::ifstream(raw_file_format::frames_file_name(bag.get_file_name())).good())
+            return false;
+        try
+        {
+            return bag.frames_format() == raw_file_format::format_name;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Failed to read the frames format of " << bag.get_file_name() << ": " << e.what());
+        }
+        return false;
+    }
+
+    void raw_reader::read_index()
+    {
+        auto const frames_file = raw_file_format::frames_file_name(m_file_path);
+        m_frames_file.open(frames_file, std::ios::binary);
+        if (!m_frames_file)
+            throw io_exception(rsutils::string::from() << "Failed to open " << frames_file);
+
+        raw_file_format::file_header header;
+        if (!m_frames_file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || memcmp(header.magic, raw_file_format::magic, sizeof(header.magic)))
+            throw io_exception(rsutils::string::from() << frames_file << " is not a frames file");
+        if (header.version != raw_file_format::version || header.byte_order != raw_file_format::byte_order)
+            throw io_exception(rsutils::string::from() << frames_file << " is of an unsupported version or byte order");
+        if (!header.index_offset)
+            throw io_exception(rsutils::string::from() << frames_file << " has no index: the recording didn't end properly");
+        m_frames_file.seekg(0, std::ios::end);
+        uint64_t const file_size = m_frames_file.tellg();
+        if (header.index_offset > file_size || header.index_size > file_size - header.index_offset)
+            throw invalid_value_exception(rsutils::string::from() << "The index of " << frames_file << " is past its end");
+
+        m_frames_file.seekg(header.index_offset);
+        auto read = [&](void* data, size_t size)
+        {
+            if (!m_frames_file.read(static_cast<char*>(data), size))
+                throw io_exception(rsutils::string::from() << "The index of " << frames_file << " is truncated");
+        };
+        uint32_t stream_count;
+        read(&stream_count, sizeof(stream_count));
+        if (stream_count > header.index_size / sizeof(raw_file_format::stream_entry))
+            throw invalid_value_exception(rsutils::string::from() << "The index of " << frames_file << " has an invalid stream count, " << stream_count);
+        std::vector<raw_file_format::stream_entry> streams(stream_count);
+        read(streams.data(), streams.size() * sizeof(raw_file_format::stream_entry));
+        for (auto& stream : streams)
+            m_streams.push_back({ stream.device_index, stream.sensor_index, rs2_stream(stream.stream_type), stream.stream_index });
+        uint64_t frame_count;
+        read(&frame_count, sizeof(frame_count));
+        if (frame_count > header.index_size / sizeof(raw_file_format::index_entry))
+            throw io_exception(rsutils::string::from() << "The index of " << frames_file << " is corrupt");
+        m_frames.resize(size_t(frame_count));
+        read(m_frames.data(), m_frames.size() * sizeof(raw_file_format::index_entry));
+
+        std::stable_sort(m_frames.begin(), m_frames.end(),
+                         [](const raw_file_format::index_entry& a, const raw_file_format::index_entry& b) { return a.time < b.time; });
+        for (size_t i = 0; i < m_frames.size(); ++i)
+        {
+            if (m_frames[i].stream >= m_streams.size())
+                throw io_exception(rsutils::string::from() << "The index of " << frames_file << " is corrupt");
+            auto& stream = m_stream_frames[m_streams[m_frames[i].stream]];
+            stream.frames.push_back(i);
+            stream.timestamps.emplace_back(m_frames[i].time);
+        }
+
+        // As the bag's, the time between the first frame and the last
+        m_duration = std::max(nanoseconds(0), m_bag->query_duration());
+        if (!m_frames.empty())
+            m_duration = std::max(m_duration, nanoseconds(m_frames.back().time - m_frames.front().time));
+        LOG_DEBUG("Read the index of " << m_frames.size() << " frames from " << frames_file);
+    }
+
+    device_snapshot raw_reader::query_device_description(const nanoseconds& time)
+    {
+        return m_bag->query_device_description(time);
+    }
+
+    std::shared_ptr<serialized_data> raw_reader::read_next_data()
+    {
+        if (!m_next_bag_data)
+            m_next_bag_data = m_bag->read_next_data();
+        while (m_next_frame < m_frames.size() && !m_enabled_streams.count(m_streams[m_frames[m_next_frame].stream]))
+            ++m_next_frame;
+
+        bool const bag_ended = m_next_bag_data->is<serialized_end_of_file>();
+        if (m_next_frame < m_frames.size()
+            && (bag_ended || nanoseconds(m_frames[m_next_frame].time) <= m_next_bag_data->get_timestamp()))
+        {
+            LOG_DEBUG("Next data is a frame");
+            return read_frame_record(m_next_frame++);
+        }
+        if (bag_ended)
+            return m_next_bag_data;
+        std::shared_ptr<serialized_data> data;
+        std::swap(data, m_next_bag_data);
+        return data;
+    }
+
+    void raw_reader::drop_bag_end_of_file()
+    {
+        // The bag may have more to read once streams are enabled; data read but not yet returned is kept
+        if (m_next_bag_data && m_next_bag_data->is<serialized_end_of_file>())
+            m_next_bag_data.reset();
+    }
+
+    void raw_reader::seek_to_time(const nanoseconds& seek_time)
+    {
+        if (seek_time > m_duration)
+        {
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "Requested time is out of playback length. (Requested = "
+                                           << seek_time.count() << ", Duration = " << m_duration.count() << ")" );
+        }
+        m_bag->seek_to_time(std::min(seek_time, std::max(nanoseconds(0), m_bag->query_duration())));
+        m_next_bag_data.reset();
+        m_next_frame = std::lower_bound(m_frames.begin(), m_frames.end(), seek_time,
+                                        [](const raw_file_format::index_entry& e, const nanoseconds& t) { return nanoseconds(e.time) < t; })
+                     - m_frames.begin();
+    }
+
+    std::vector<std::shared_ptr<serialized_data>> raw_reader::fetch_last_frames(const nanoseconds& seek_time)
+    {
+        auto result = m_bag->fetch_last_frames(seek_time);
+        for (auto&& stream_id : m_enabled_streams)
+        {
+            auto stream = m_stream_frames.find(stream_id);
+            if (stream == m_stream_frames.end())
+                continue;
+            auto& timestamps = stream->second.timestamps;
+            auto after = std::upper_bound(timestamps.begin(), timestamps.end(), seek_time);
+            if (after == timestamps.begin())
+                continue;
+            result.push_back(read_frame_record(stream->second.frames[after - timestamps.begin() - 1]));
+        }
+        return result;
+    }
+
+    nanoseconds raw_reader::query_duration() const
+    {
+        return m_duration;
+    }
+
+    void raw_reader::reset()
+    {
+        m_bag->reset();
+        m_enabled_streams.clear();
+        m_next_frame = 0;
+        m_next_bag_data.reset();
+        m_frame_source = std::make_shared<frame_source>(32);
+        m_frame_source->init(m_metadata_parser_map);
+    }
+
+    void raw_reader::enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
+    {
+        m_bag->enable_stream(stream_ids);
+        drop_bag_end_of_file();
+        m_enabled_streams.insert(stream_ids.begin(), stream_ids.end());
+    }
+
+    void raw_reader::disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
+    {
+        m_bag->disable_stream(stream_ids);
+        drop_bag_end_of_file();
+        for (auto&& stream_id : stream_ids)
+            m_enabled_streams.erase(stream_id);
+    }
+
+    const std::string& raw_reader::get_file_name() const
+    {
+        return m_file_path;
+    }
+
+    void raw_reader::set_max_throughput(bool max_throughput)
+    {
+        // Frames are read as they are; only the bag is compressed
+        m_bag->set_max_throughput(max_throughput);
+    }
+
+    std::shared_ptr<serialized_frame> raw_reader::read_frame(const stream_identifier& stream_id, unsigned long long frame_number)
+    {
+        auto stream = m_stream_frames.find(stream_id);
+        if (stream == m_stream_frames.end())
+            return m_bag->read_frame(stream_id, frame_number);
+        // Frame numbers may restart within a recording: the first frame with the number is the one taken
+        for (auto i : stream->second.frames)
+            if (m_frames[i].frame_number == frame_number)
+                return read_stream_frame(i);
+        return nullptr;
+    }
+
+    std::shared_ptr<serialized_frame> raw_reader::read_frame_at(const stream_identifier& stream_id, const nanoseconds& time)
+    {
+        auto stream = m_stream_frames.find(stream_id);
+        if (stream == m_stream_frames.end())
+            return m_bag->read_frame_at(stream_id, time);
+        auto& timestamps = stream->second.timestamps;
+        auto after = std::lower_bound(timestamps.begin(), timestamps.end(), time);
+        if (after == timestamps.end() || (after != timestamps.begin() && time - *std::prev(after) <= *after - time))
+            after = std::lower_bound(timestamps.begin(), after, *std::prev(after));
+        return read_stream_frame(stream->second.frames[after - timestamps.begin()]);
+    }
+
+    std::shared_ptr<serialized_frame> raw_reader::read_stream_frame(size_t i)
+    {
+        auto frame = read_frame_record(i);
+        if (!frame->frame)
+            throw io_exception("Failed to allocate a frame; too many frames of the stream may be held");
+        return frame;
+    }
+
+    std::shared_ptr<serialized_frame> raw_reader::read_frame_record(size_t i)
+    {
+        auto& entry = m_frames[i];
+        auto& stream_id = m_streams[entry.stream];
+        nanoseconds timestamp(entry.time);
+
+        raw_file_format::frame_record record;
+        frame_additional_data additional_data{};
+        m_frames_file.clear();
+        m_frames_file.seekg(entry.offset);
+        if (!m_frames_file.read(reinterpret_cast<char*>(&record), sizeof(record))
+            || record.metadata_size > additional_data.metadata_blob.size()
+            || sizeof(record) + record.metadata_size + record.data_size != entry.size
+            || !m_frames_file.read(reinterpret_cast<char*>(additional_data.metadata_blob.data()), record.metadata_size))
+        {
+            throw io_exception(rsutils::string::from() << "Frame of " << stream_id << " at " << entry.time
+                                                       << " ns is corrupt or missing from the file");
+        }
+        additional_data.timestamp = record.timestamp;
+        additional_data.frame_number = record.frame_number;
+        additional_data.timestamp_domain = rs2_timestamp_domain(record.timestamp_domain);
+        additional_data.system_time = record.system_time;
+        additional_data.depth_units = record.depth_units;
+        additional_data.metadata_size = record.metadata_size;
+
+        frame_interface * frame = m_frame_source->alloc_frame(
+            { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
+            size_t(record.data_size),
+            std::move( additional_data ),
+            true );
+        if (frame == nullptr)
+        {
+            LOG_WARNING("Failed to allocate new frame");
+            return std::make_shared<serialized_invalid_frame>(timestamp, stream_id);
+        }
+        auto video = static_cast<librealsense::video_frame*>(frame);
+        frame_holder fh{ video };
+        video->assign(record.width, record.height, record.stride, record.bpp);
+        if (!m_frames_file.read(reinterpret_cast<char*>(video->data.data()), record.data_size))
+            throw io_exception(rsutils::string::from() << "Frame of " << stream_id << " at " << entry.time << " ns is truncated");
+        //attaching a temp stream to the frame. Playback sensor should assign the real stream
+        frame->set_stream( std::make_shared< video_stream_profile >() );
+        frame->get_stream()->set_format(rs2_format(record.format));
+        frame->get_stream()->set_stream_index(int(stream_id.stream_index));
+        frame->get_stream()->set_stream_type(stream_id.stream_type);
+        return std::make_shared<serialized_frame>(timestamp, stream_id, std::move(fh));
+    }
+}
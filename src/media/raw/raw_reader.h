@@ -0,0 +1,64 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include "raw_file_format.h"
+#include "media/ros/ros_reader.h"
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Reads a recording in the raw format (see raw_file_format): video frames from the frames file, merged by time
+    // with the rest, read through ros_reader
+    class raw_reader: public device_serializer::reader
+    {
+    public:
+        // Takes over the bag of the recording, already open; it's left as it was if this throws
+        raw_reader(const std::shared_ptr<ros_reader>& bag);
+        // True if the bag was recorded in the raw format, as it says, and its frames file is there
+        static bool is_raw(const ros_reader& bag);
+
+        device_snapshot query_device_description(const nanoseconds& time) override;
+        std::shared_ptr<serialized_data> read_next_data() override;
+        void seek_to_time(const nanoseconds& seek_time) override;
+        std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override;
+        nanoseconds query_duration() const override;
+        void reset() override;
+        void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
+        void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
+        const std::string& get_file_name() const override;
+        void set_max_throughput(bool max_throughput) override;
+        std::shared_ptr<serialized_frame> read_frame(const stream_identifier& stream_id, unsigned long long frame_number) override;
+        std::shared_ptr<serialized_frame> read_frame_at(const stream_identifier& stream_id, const nanoseconds& time) override;
+
+    private:
+        struct stream_frames
+        {
+            std::vector<size_t> frames;             // in m_frames
+            std::vector<nanoseconds> timestamps;    // of each
+        };
+
+        void read_index();
+        std::shared_ptr<serialized_frame> read_frame_record(size_t i);
+        std::shared_ptr<serialized_frame> read_stream_frame(size_t i);
+        void drop_bag_end_of_file();
+
+        std::string m_file_path;
+        std::shared_ptr<ros_reader> m_bag;
+        std::ifstream m_frames_file;
+        std::vector<stream_identifier> m_streams;                  // of the index
+        std::vector<raw_file_format::index_entry> m_frames;        // in time order
+        std::map<stream_identifier, stream_frames> m_stream_frames;
+        std::set<stream_identifier> m_enabled_streams;
+        size_t m_next_frame;
+        std::shared_ptr<serialized_data> m_next_bag_data;          // read from the bag, not yet returned
+        nanoseconds m_duration;
+        std::shared_ptr<metadata_parser_map> m_metadata_parser_map;
+        std::shared_ptr<frame_source> m_frame_source;
+    };
+}
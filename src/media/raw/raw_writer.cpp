@@ -0,0 +1,400 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "raw_writer.h"
+#include <src/core/video-frame.h>
+#include <src/core/depth-frame.h>
+#include <src/tracing.h>
+
+#include <rsutils/string/from.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace librealsense
+{
+    using namespace device_serializer;
+
+    namespace
+    {
+        size_t const staging_size = 8 << 20;
+
+        uint64_t align_up( uint64_t size ) { return ( size + raw_file_format::block_size - 1 ) / raw_file_format::block_size * raw_file_format::block_size; }
+
+        std::string last_error()
+        {
+#ifdef _WIN32
+            return rsutils::string::from() << "error " << GetLastError();
+#else
+            return strerror( errno );
+#endif
+        }
+    }
+
+    direct_file::direct_file(const std::string& path)
+        : m_path(path)
+        , m_handle(-1)
+        , m_direct(false)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING, NULL);
+        m_direct = file != INVALID_HANDLE_VALUE;
+        if (!m_direct)
+            file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            throw io_exception(rsutils::string::from() << "Failed to create " << path << ": " << last_error());
+        m_handle = intptr_t(file);
+#else
+        int const flags = O_WRONLY | O_CREAT | O_TRUNC;
+        int fd = -1;
+#ifdef O_DIRECT
+        fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        m_direct = fd >= 0;
+#endif
+        if (fd < 0)  // e.g., the file system doesn't support it
+            fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0)
+            throw io_exception(rsutils::string::from() << "Failed to create " << path << ": " << last_error());
+#ifdef __APPLE__
+        m_direct = fcntl(fd, F_NOCACHE, 1) == 0;
+#endif
+        m_handle = fd;
+#endif
+        if (!m_direct)
+            LOG_INFO(path << " is written through the page cache: direct I/O is not supported");
+    }
+
+    direct_file::~direct_file()
+    {
+        try
+        {
+            close();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR(e.what());
+        }
+    }
+
+    void direct_file::write(const void* data, size_t size, uint64_t offset)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        while (size)
+        {
+#ifdef _WIN32
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = DWORD(offset);
+            overlapped.OffsetHigh = DWORD(offset >> 32);
+            DWORD written = 0;
+            if (!WriteFile(HANDLE(m_handle), bytes, DWORD(std::min(size, size_t(1) << 30)), &written, &overlapped))
+                throw io_exception(rsutils::string::from() << "Failed to write to " << m_path << ": " << last_error());
+#else
+            auto written = ::pwrite(int(m_handle), bytes, size, off_t(offset));
+            if (written < 0 && errno == EINTR)
+                continue;
+            if (written <= 0)
+                throw io_exception(rsutils::string::from() << "Failed to write to " << m_path << ": " << last_error());
+#endif
+            bytes += written;
+            size -= written;
+            offset += written;
+        }
+    }
+
+    void direct_file::preallocate(uint64_t size)
+    {
+#ifdef _WIN32
+        FILE_ALLOCATION_INFO info;
+        info.AllocationSize.QuadPart = LONGLONG(size);
+        if (!SetFileInformationByHandle(HANDLE(m_handle), FileAllocationInfo, &info, sizeof(info)))
+            LOG_DEBUG("Failed to preallocate " << m_path << ": " << last_error());
+#elif defined(__linux__)
+        // Not posix_fallocate, which writes the file where the file system can't allocate it
+        if (fallocate(int(m_handle), 0, 0, off_t(size)) != 0)
+            LOG_DEBUG("Failed to preallocate " << m_path << ": " << last_error());
+#else
+        (void)size;
+#endif
+    }
+
+    void direct_file::end_direct()
+    {
+        if (!m_direct)
+            return;
+        close();
+#ifdef _WIN32
+        HANDLE file = CreateFileA(m_path.c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            throw io_exception(rsutils::string::from() << "Failed to reopen " << m_path << ": " << last_error());
+        m_handle = intptr_t(file);
+#else
+        int fd = ::open(m_path.c_str(), O_WRONLY);
+        if (fd < 0)
+            throw io_exception(rsutils::string::from() << "Failed to reopen " << m_path << ": " << last_error());
+        m_handle = fd;
+#endif
+        m_direct = false;
+    }
+
+    void direct_file::truncate(uint64_t size)
+    {
+#ifdef _WIN32
+        LARGE_INTEGER end;
+        end.QuadPart = LONGLONG(size);
+        if (!SetFilePointerEx(HANDLE(m_handle), end, NULL, FILE_BEGIN) || !SetEndOfFile(HANDLE(m_handle)))
+#else
+        if (ftruncate(int(m_handle), off_t(size)) != 0)
+#endif
+            throw io_exception(rsutils::string::from() << "Failed to truncate " << m_path << ": " << last_error());
+    }
+
+    void direct_file::close()
+    {
+        if (m_handle == -1)
+            return;
+#ifdef _WIN32
+        bool closed = CloseHandle(HANDLE(m_handle)) != 0;
+#else
+        bool closed = ::close(int(m_handle)) == 0;
+#endif
+        m_handle = -1;
+        if (!closed)
+            throw io_exception(rsutils::string::from() << "Failed to close " << m_path << ": " << last_error());
+    }
+
+    raw_writer::raw_writer(const std::string& file, bool compress_while_record, bool write_index, uint64_t segment_size)
+        : m_bag(file, compress_while_record, false, write_index)
+        , m_frames(raw_file_format::frames_file_name(file))
+        , m_segment_size(align_up(std::max<uint64_t>(segment_size, staging_size)))
+        , m_preallocated(0)
+        , m_staging(2)
+        , m_staging_index(0)
+        , m_staged(0)
+        , m_staged_offset(raw_file_format::block_size)  // after the header
+        , m_io_thread(2)
+        , m_closed(false)
+    {
+        for (auto& buffer : m_staging)
+        {
+            buffer.storage.resize(staging_size + raw_file_format::block_size);
+            auto address = reinterpret_cast<uintptr_t>(buffer.storage.data());
+            buffer.data = buffer.storage.data() + (align_up(address) - address);
+        }
+        m_io_thread.start();
+        m_bag.write_frames_format(raw_file_format::format_name);
+        LOG_INFO("Recording video frames to " << raw_file_format::frames_file_name(file));
+    }
+
+    raw_writer::~raw_writer()
+    {
+        try
+        {
+            close();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Failed to close " << raw_file_format::frames_file_name(m_bag.get_file_name()) << ": " << e.what());
+        }
+    }
+
+    void raw_writer::write_device_description(const librealsense::device_snapshot& device_description)
+    {
+        m_bag.write_device_description(device_description);
+    }
+
+    void raw_writer::write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    {
+        // Motion and pose samples are small enough for the bag
+        if (Is<video_frame>(frame.frame))
+            write_video_frame(stream_id, timestamp, std::move(frame));
+        else
+            m_bag.write_frame(stream_id, timestamp, std::move(frame));
+    }
+
+    void raw_writer::write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot)
+    {
+        m_bag.write_snapshot(device_index, timestamp, type, snapshot);
+    }
+
+    void raw_writer::write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot)
+    {
+        m_bag.write_snapshot(sensor_id, timestamp, type, snapshot);
+    }
+
+    void raw_writer::write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n)
+    {
+        writer& bag = m_bag;
+        bag.write_notification(sensor_id, timestamp, n);
+    }
+
+    const std::string& raw_writer::get_file_name() const
+    {
+        return m_bag.get_file_name();
+    }
+
+    void raw_writer::write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    {
+        LRS_TRACE_SCOPE( "raw_writer write frame" );
+        if (m_closed)
+            throw io_exception("Frames file is closed");
+        auto vid_frame = dynamic_cast<librealsense::video_frame*>(frame.frame);
+        if (!vid_frame)
+            throw std::runtime_error("Frame is not video frame");
+
+        raw_file_format::frame_record record = {};
+        record.timestamp = vid_frame->get_frame_timestamp();
+        record.system_time = vid_frame->get_frame_system_time();
+        record.frame_number = vid_frame->get_frame_number();
+        record.timestamp_domain = vid_frame->get_frame_timestamp_domain();
+        record.format = vid_frame->get_stream()->get_format();
+        record.width = uint32_t(vid_frame->get_width());
+        record.height = uint32_t(vid_frame->get_height());
+        record.stride = uint32_t(vid_frame->get_stride());
+        record.bpp = uint32_t(vid_frame->get_bpp());
+        if (auto df = dynamic_cast<librealsense::depth_frame*>(frame.frame))
+            record.depth_units = df->get_units();
+        record.data_size = uint64_t(record.stride) * record.height;
+
+        // As read back by md_constant_parser
+        metadata_blob_type metadata;
+        for (int i = 0; i < static_cast<int>(RS2_FRAME_METADATA_COUNT); i++)
+        {
+            auto type = static_cast<rs2_frame_metadata_value>(i);
+            rs2_metadata_type value;
+            if (record.metadata_size + sizeof(type) + sizeof(value) > metadata.size())
+                break;
+            if (vid_frame->find_metadata(type, &value))
+            {
+                memcpy(metadata.data() + record.metadata_size, &type, sizeof(type));
+                memcpy(metadata.data() + record.metadata_size + sizeof(type), &value, sizeof(value));
+                record.metadata_size += uint32_t(sizeof(type) + sizeof(value));
+            }
+        }
+
+        auto stream = m_streams.emplace(stream_id, uint32_t(m_streams.size())).first->second;
+        raw_file_format::index_entry entry;
+        entry.time = timestamp.count();
+        entry.offset = m_staged_offset + m_staged;
+        entry.stream = stream;
+        entry.size = uint32_t(sizeof(record) + record.metadata_size + record.data_size);
+        entry.frame_number = record.frame_number;
+
+        append(&record, sizeof(record));
+        append(metadata.data(), record.metadata_size);
+        append(vid_frame->get_frame_data(), size_t(record.data_size));
+        m_index.push_back(entry);
+
+        try
+        {
+            m_bag.write_extrinsics(stream_id, frame.frame);
+        }
+        catch (std::exception const& e)
+        {
+            LOG_WARNING("Failed to write stream extrinsics for " << stream_id.stream_type << ". Exception: " << e.what());
+        }
+    }
+
+    void raw_writer::append(const void* data, size_t size)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        while (size)
+        {
+            auto n = std::min(size, staging_size - m_staged);
+            memcpy(m_staging[m_staging_index].data + m_staged, bytes, n);
+            m_staged += n;
+            bytes += n;
+            size -= n;
+            if (m_staged == staging_size)
+                write_staged(staging_size);
+        }
+    }
+
+    void raw_writer::write_staged(size_t size)
+    {
+        // The other buffer is filled while this one is written
+        wait_for_writes();
+        auto data = m_staging[m_staging_index].data;
+        auto offset = m_staged_offset;
+        m_io_thread.invoke([this, data, size, offset](dispatcher::cancellable_timer)
+        {
+            try
+            {
+                // The file grows a segment at a time
+                while (offset + size > m_preallocated)
+                {
+                    m_preallocated += m_segment_size;
+                    m_frames.preallocate(m_preallocated);
+                }
+                m_frames.write(data, size, offset);
+            }
+            catch (...)
+            {
+                m_io_error = std::current_exception();
+            }
+        }, true);
+        m_staged_offset += size;
+        m_staging_index = (m_staging_index + 1) % m_staging.size();
+        m_staged = 0;
+    }
+
+    void raw_writer::wait_for_writes()
+    {
+        if (!m_io_thread.flush())
+            throw io_exception("Timeout waiting for frames to be written");
+        if (m_io_error)
+            std::rethrow_exception(m_io_error);  // and again for any frame that follows
+    }
+
+    void raw_writer::close()
+    {
+        if (m_closed)
+            return;
+        m_closed = true;
+
+        // The last of the frames, padded to a whole block; the index follows it
+        auto const data_end = m_staged_offset + m_staged;
+        if (m_staged)
+        {
+            auto padded = size_t(align_up(m_staged));
+            memset(m_staging[m_staging_index].data + m_staged, 0, padded - m_staged);
+            write_staged(padded);
+        }
+        wait_for_writes();
+        m_frames.end_direct();
+
+        std::vector<raw_file_format::stream_entry> streams(m_streams.size());
+        for (auto& stream : m_streams)
+            streams[stream.second] = { stream.first.device_index, stream.first.sensor_index, uint32_t(stream.first.stream_type), stream.first.stream_index };
+        std::vector<uint8_t> index;
+        auto add = [&index](const void* data, size_t size)
+        {
+            index.insert(index.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+        };
+        uint32_t const stream_count = uint32_t(streams.size());
+        add(&stream_count, sizeof(stream_count));
+        add(streams.data(), streams.size() * sizeof(raw_file_format::stream_entry));
+        uint64_t const frame_count = m_index.size();
+        add(&frame_count, sizeof(frame_count));
+        add(m_index.data(), m_index.size() * sizeof(raw_file_format::index_entry));
+
+        raw_file_format::file_header header = {};
+        memcpy(header.magic, raw_file_format::magic, sizeof(header.magic));
+        header.version = raw_file_format::version;
+        header.byte_order = raw_file_format::byte_order;
+        header.index_offset = align_up(data_end);
+        header.index_size = index.size();
+        m_frames.write(index.data(), index.size(), header.index_offset);
+        m_frames.write(&header, sizeof(header), 0);
+        m_frames.truncate(header.index_offset + header.index_size);
+        m_frames.close();
+        LOG_INFO("Wrote " << m_index.size() << " frames to " << raw_file_format::frames_file_name(m_bag.get_file_name()));
+    }
+}
@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include "raw_file_format.h"
+#include <src/core/info-interface.h>
+#include <src/core/options-interface.h>
+#include "media/ros/ros_writer.h"
+
+#include <rsutils/concurrency/concurrency.h>
+
+#include <map>
+#include <vector>
+
+
+namespace librealsense
+{
+    // A file written with direct I/O, bypassing the page cache where the platform and file system allow it: writes
+    // must then be of whole blocks, from block-aligned memory, at block-aligned offsets
+    class direct_file
+    {
+    public:
+        explicit direct_file(const std::string& path);
+        ~direct_file();
+        bool is_direct() const { return m_direct; }
+        void write(const void* data, size_t size, uint64_t offset);
+        // Reserves disk space up to the given size, so writes don't allocate extents as they go
+        void preallocate(uint64_t size);
+        // Leaves direct I/O, for the final unaligned writes
+        void end_direct();
+        void truncate(uint64_t size);
+        void close();
+
+    private:
+        std::string m_path;
+        intptr_t m_handle;
+        bool m_direct;
+    };
+
+    // Writes video frames to a frames file in the raw format (see raw_file_format), and the rest through ros_writer
+    class raw_writer: public writer
+    {
+    public:
+        // segment_size: the frames file is preallocated this many bytes at a time
+        explicit raw_writer(const std::string& file, bool compress_while_record, bool write_index = false,
+                            uint64_t segment_size = 256 << 20);
+        ~raw_writer();
+        void write_device_description(const librealsense::device_snapshot& device_description) override;
+        void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
+        void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
+        void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
+        void write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n) override;
+        const std::string& get_file_name() const override;
+
+    private:
+        // Frames are copied into one staging buffer while the other is being written
+        struct staging_buffer
+        {
+            std::vector<uint8_t> storage;
+            uint8_t* data;
+        };
+
+        void write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void append(const void* data, size_t size);
+        void write_staged(size_t size);
+        void wait_for_writes();
+        void close();
+
+        ros_writer m_bag;
+        direct_file m_frames;
+        uint64_t m_segment_size;
+        uint64_t m_preallocated;
+        std::vector<staging_buffer> m_staging;
+        size_t m_staging_index;     // of the buffer being filled
+        size_t m_staged;            // bytes in it
+        uint64_t m_staged_offset;   // of the buffer in the file
+        dispatcher m_io_thread;
+        std::exception_ptr m_io_error;
+        std::map<stream_identifier, uint32_t> m_streams;
+        std::vector<raw_file_format::index_entry> m_index;
+        bool m_closed;
+    };
+}
@@ -10,10 +10,23 @@
 using namespace librealsense;
 
 librealsense::record_device::record_device(std::shared_ptr<librealsense::device_interface> device,
-                                      std::shared_ptr<librealsense::device_serializer::writer> serializer):
+                                      std::shared_ptr<librealsense::device_serializer::writer> serializer,
+                                      std::chrono::nanoseconds pre_trigger,
+                                      uint64_t pre_trigger_memory_limit,
+                                      record_queue_settings queue):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
     m_is_recording(true),
-    m_record_total_pause_duration(0)
+    m_record_total_pause_duration(0),
+    m_pre_trigger(pre_trigger),
+    m_pre_trigger_memory_limit(pre_trigger_memory_limit),
+    m_pre_trigger_size(0),
+    m_triggered(pre_trigger == std::chrono::nanoseconds::zero()),
+    m_record_time_base(0),
+    m_queue(std::move(queue)),
+    m_queued_size(0),
+    m_max_queued_size(0),
+    m_last_latency(0),
+    m_max_latency(0)
 {
     if (device == nullptr)
     {
@@ -25,6 +38,11 @@ librealsense::record_device::record_device(std::shared_ptr<librealsense::device_
         throw invalid_value_exception("serializer is null");
     }
 
+    if (pre_trigger < std::chrono::nanoseconds::zero())
+    {
+        throw invalid_value_exception("pre-trigger duration is negative");
+    }
+
     m_device = device;
     m_ros_writer = serializer;
     (*m_write_thread)->start(); //Start thread before creating the sensors (since they might write right away)
@@ -70,6 +88,13 @@ librealsense::record_device::~record_device()
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
     }
     (*m_write_thread)->stop();
+    //Frames the write thread didn't get to are gone with it: don't leave the sensors waiting for room for theirs
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued_frames.clear();
+        m_queued_size = 0;
+    }
+    m_queue_cv.notify_all();
     //Just in case someone still holds a reference to the sensors,
     // we make sure that they will not try to record anything
     m_sensors.clear();
@@ -138,25 +163,52 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    auto capture_time = get_capture_time();
+    auto queued = std::make_shared<queued_frame>();
+    queued->stream = { frame->get_stream()->get_stream_type(), frame->get_stream()->get_stream_index() };
+    queued->size = frame->get_frame_data_size();
+    auto priority = m_queue.stream_priority.find(queued->stream.first);
+    queued->priority = priority == m_queue.stream_priority.end() ? 0 : priority->second;
+    queued->arrival = std::chrono::steady_clock::now();
+    queued->frame = std::move(frame);
+    // With a bounded policy, what waits is bounded by it rather than by the frames the sensor may have published at a
+    // time; unbounded, the sensor's limit is the only one, as without a policy
+    if (m_queue.policy != record_queue_policy::unbounded)
+        queued->frame->keep();
+    std::vector<frame_holder> dropped;  // released once unlocked
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
-        return;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!admit_frame(lock, *queued, dropped))
+        {
+            ++m_frame_counts[queued->stream].dropped;
+            LOG_DEBUG("Recording queue is full, frame dropped");
+            return;
+        }
+        m_queued_frames.push_back(queued);
+        m_queued_size += queued->size;
+        m_max_queued_size = std::max(m_max_queued_size, m_queued_size);
     }
+    dropped.clear();
 
-    m_cached_data_size = cached_data_size;
-    auto capture_time = get_capture_time();
-    //TODO: remove usage of shared pointer when frame_holder is copyable
-    auto frame_holder_ptr = std::make_shared<frame_holder>();
-    *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
+    (*m_write_thread)->invoke([this, queued, sensor_index, capture_time, on_error](dispatcher::cancellable_timer t) {
+        auto frame = dequeue_frame(*queued);
+        if (!frame)
+        {
+            return; //Dropped for a frame of a stream of higher priority
+        }
         if (m_is_recording == false)
         {
             return; //Recording is paused
         }
+        const uint32_t device_index = 0;
+        auto stream_type = frame->get_stream()->get_stream_type();
+        auto stream_index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
+        device_serializer::stream_identifier stream_id{ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index };
+        if (!m_triggered)
+        {
+            keep_pre_trigger_frame(stream_id, capture_time, std::move(frame), on_error);
+            return;
+        }
         std::call_once(m_first_frame_flag, [&]()
         {
             try
@@ -172,19 +224,111 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
 
         try
         {
-            const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            m_ros_writer->write_frame(stream_id, get_record_time(capture_time), std::move(frame));
         }
         catch(std::exception& e)
         {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_frame_counts[queued->stream].dropped;
+            }
             on_error( std::string( "Failed to write frame. " ) + e.what() );
+            return;
         }
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - queued->arrival);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_frame_counts[queued->stream].written;
+        m_last_latency = latency;
+        m_max_latency = std::max(m_max_latency, latency);
     });
 }
 
+bool librealsense::record_device::admit_frame(std::unique_lock<std::mutex>& lock, const queued_frame& frame, std::vector<frame_holder>& dropped)
+{
+    auto has_room = [&]()
+    {
+        // A frame larger than the limit is queued on its own
+        return m_queued_size + frame.size <= m_queue.memory_limit || m_queued_frames.empty();
+    };
+    if (m_queue.policy == record_queue_policy::unbounded || has_room())
+        return true;
+
+    switch (m_queue.policy)
+    {
+    case record_queue_policy::block:
+        m_queue_cv.wait(lock, has_room);
+        return true;
+
+    case record_queue_policy::drop_by_priority:
+    {
+        uint64_t lower_priority_size = 0;
+        for (auto&& f : m_queued_frames)
+            if (f->priority < frame.priority)
+                lower_priority_size += f->size;
+        if (m_queued_size - lower_priority_size + frame.size > m_queue.memory_limit)
+            return false;
+        while (!has_room())
+        {
+            // The lowest priority, and the newest of it
+            auto victim = m_queued_frames.end();
+            for (auto it = m_queued_frames.begin(); it != m_queued_frames.end(); ++it)
+                if ((*it)->priority < frame.priority && (victim == m_queued_frames.end() || (*it)->priority <= (*victim)->priority))
+                    victim = it;
+            auto& f = **victim;
+            ++m_frame_counts[f.stream].dropped;
+            m_queued_size -= f.size;
+            dropped.push_back(std::move(f.frame));
+            m_queued_frames.erase(victim);
+        }
+        LOG_DEBUG("Recording queue is full, dropped " << dropped.size() << " frames of lower priority");
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+librealsense::frame_holder librealsense::record_device::dequeue_frame(queued_frame& frame)
+{
+    frame_holder f;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!frame.frame)
+            return f;
+        f = std::move(frame.frame);
+        m_queued_size -= frame.size;
+        // Frames are written in order, so this one is at the front
+        auto it = std::find_if(m_queued_frames.begin(), m_queued_frames.end(),
+                               [&](const std::shared_ptr<queued_frame>& q) { return q.get() == &frame; });
+        if (it != m_queued_frames.end())
+            m_queued_frames.erase(it);
+    }
+    m_queue_cv.notify_all();
+    return f;
+}
+
+librealsense::record_device::frame_counts librealsense::record_device::get_frame_counts(rs2_stream stream, int index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto counts = m_frame_counts.find({ stream, index });
+    if (counts == m_frame_counts.end())
+        return { 0, 0 };
+    return counts->second;
+}
+
+rs2_record_queue_telemetry librealsense::record_device::get_queue_telemetry() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rs2_record_queue_telemetry telemetry;
+    telemetry.frames = m_queued_frames.size();
+    telemetry.bytes = m_queued_size;
+    telemetry.max_bytes = m_max_queued_size;
+    telemetry.latency = std::chrono::duration<double, std::milli>(m_last_latency).count();
+    telemetry.max_latency = std::chrono::duration<double, std::milli>(m_max_latency).count();
+    return telemetry;
+}
+
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
 {
     return m_device->get_info(info);
@@ -274,10 +418,12 @@ void librealsense::record_device::write_device_extension_changes(const T& ext)
     auto capture_time = get_capture_time();
     (*m_write_thread)->invoke([this, capture_time, ext_snapshot](dispatcher::cancellable_timer t)
     {
+        if (!m_triggered)
+            return; // The header, written on trigger, has the state at that time
         try
         {
             const uint32_t device_index = 0;
-            m_ros_writer->write_snapshot(device_index, capture_time, TypeToExtension<T>::value, ext_snapshot);
+            m_ros_writer->write_snapshot(device_index, get_record_time(capture_time), TypeToExtension<T>::value, ext_snapshot);
         }
         catch (const std::exception& e)
         {
@@ -294,10 +440,12 @@ void record_device::write_sensor_extension_snapshot(size_t sensor_index,
     auto capture_time = get_capture_time();
     (*m_write_thread)->invoke([this, sensor_index, capture_time, ext, snapshot, on_error](dispatcher::cancellable_timer t)
     {
+        if (!m_triggered)
+            return; // The header, written on trigger, has the state at that time
         try
         {
             const uint32_t device_index = 0;
-            m_ros_writer->write_snapshot({ device_index, static_cast<uint32_t>(sensor_index) }, capture_time, ext, snapshot);
+            m_ros_writer->write_snapshot({ device_index, static_cast<uint32_t>(sensor_index) }, get_record_time(capture_time), ext, snapshot);
         }
         catch (const std::exception& e)
         {
@@ -311,10 +459,12 @@ void librealsense::record_device::write_notification(size_t sensor_index, const
     auto capture_time = get_capture_time();
     (*m_write_thread)->invoke([this, sensor_index, capture_time, n](dispatcher::cancellable_timer t)
     {
+        if (!m_triggered)
+            return; // Only frames are kept before the trigger
         try
         {
             const uint32_t device_index = 0;
-            m_ros_writer->write_notification({ device_index, static_cast<uint32_t>(sensor_index) }, capture_time, n);
+            m_ros_writer->write_notification({ device_index, static_cast<uint32_t>(sensor_index) }, get_record_time(capture_time), n);
         }
         catch (const std::exception& e)
         {
@@ -429,6 +579,81 @@ void librealsense::record_device::resume_recording()
     });
 }
 
+void librealsense::record_device::keep_pre_trigger_frame(const device_serializer::stream_identifier& stream_id,
+                                                        std::chrono::nanoseconds capture_time,
+                                                        frame_holder&& frame,
+                                                        std::function<void(std::string const&)> on_error)
+{
+    // The frame is held as is, but no longer counts against the frames its sensor may have published at a time
+    frame->keep();
+    uint64_t size = frame->get_frame_data_size();
+    m_pre_trigger_frames.push_back({ stream_id, capture_time, std::move(frame), size, on_error });
+    m_pre_trigger_size += size;
+    while (!m_pre_trigger_frames.empty()
+           && (capture_time - m_pre_trigger_frames.front().capture_time > m_pre_trigger
+               || m_pre_trigger_size > m_pre_trigger_memory_limit))
+    {
+        m_pre_trigger_size -= m_pre_trigger_frames.front().size;
+        m_pre_trigger_frames.pop_front();
+    }
+}
+
+//Returns the time at which data captured at the given time is written: the recording starts with the oldest frame
+//kept before the trigger
+std::chrono::nanoseconds librealsense::record_device::get_record_time(std::chrono::nanoseconds capture_time) const
+{
+    return std::max(std::chrono::nanoseconds::zero(), capture_time - m_record_time_base);
+}
+
+void librealsense::record_device::trigger()
+{
+    LOG_INFO("Record trigger called");
+    auto capture_time = get_capture_time();
+    (*m_write_thread)->invoke([this, capture_time](dispatcher::cancellable_timer c)
+    {
+        if (m_triggered)
+            return;
+
+        m_triggered = true;
+        m_record_time_base = m_pre_trigger_frames.empty() ? capture_time : m_pre_trigger_frames.front().capture_time;
+        LOG_DEBUG("Writing " << m_pre_trigger_frames.size() << " frames kept before the trigger, from capture time "
+                             << m_record_time_base.count());
+        std::call_once(m_first_frame_flag, [&]()
+        {
+            try
+            {
+                write_header();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Failed to write header. " << e.what());
+            }
+        });
+        for (auto&& f : m_pre_trigger_frames)
+        {
+            std::pair<rs2_stream, int> stream{ f.stream_id.stream_type, int(f.stream_id.stream_index) };
+            try
+            {
+                m_ros_writer->write_frame(f.stream_id, get_record_time(f.capture_time), std::move(f.frame));
+            }
+            catch (std::exception& e)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    ++m_frame_counts[stream].dropped;
+                }
+                f.on_error(std::string("Failed to write frame. ") + e.what());
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_frame_counts[stream].written;
+        }
+        m_pre_trigger_frames.clear();
+        m_pre_trigger_size = 0;
+        LOG_INFO("Record triggered");
+    });
+}
+
 const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
@@ -446,7 +671,6 @@ void record_device::initialize_recording()
 {
     //Expected to be called once when recording to file actually starts
     m_capture_time_base = std::chrono::high_resolution_clock::now();
-    m_cached_data_size = 0;
     LOG_DEBUG( "Recording capture time base set to: " << m_capture_time_base.time_since_epoch().count() );
 
 }
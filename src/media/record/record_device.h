@@ -12,9 +12,31 @@
 #include <rsutils/concurrency/concurrency.h>
 #include <rsutils/lazy.h>
 
+#include <condition_variable>
+#include <deque>
+#include <map>
+
 
 namespace librealsense
 {
+    // What a recording does with a frame arriving when the frames waiting to be written are at the memory limit
+    enum class record_queue_policy
+    {
+        unbounded,          // no limit of the recording's own: the frame is queued, and the frames waiting are bounded
+                            // only by those the sensor may have published at a time (beyond which it drops them)
+        block,              // the frame is queued once there's room, blocking the sensor until then
+        drop_newest,        // the frame is dropped
+        drop_by_priority,   // queued frames of streams of lower priority are dropped to make room, the lowest and
+                            // newest first; if that isn't enough, the frame is dropped
+    };
+
+    struct record_queue_settings
+    {
+        record_queue_policy policy = record_queue_policy::unbounded;
+        uint64_t memory_limit = 0;                      // bytes of frame data waiting to be written
+        std::map<rs2_stream, int> stream_priority;      // for drop_by_priority, 0 for streams not in it
+    };
+
     class record_device : public device_interface,
                           public extendable_interface,
                           public info_container
@@ -22,7 +44,19 @@ namespace librealsense
     public:
         static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
 
-        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
+        struct frame_counts
+        {
+            uint64_t written;
+            uint64_t dropped;   // by the queue policy, or failed to write
+        };
+
+        // pre_trigger: if non-zero, frames are not written until trigger() is called; until then, the frames of the
+        //     last pre_trigger are kept in memory (up to pre_trigger_memory_limit bytes of frame data), to be written
+        //     first once triggered
+        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer,
+                      std::chrono::nanoseconds pre_trigger = std::chrono::nanoseconds::zero(),
+                      uint64_t pre_trigger_memory_limit = 0,
+                      record_queue_settings queue = {});
         virtual ~record_device();
 
         std::shared_ptr<context> get_context() const override;
@@ -40,6 +74,10 @@ namespace librealsense
 
         void pause_recording();
         void resume_recording();
+        // Writes the frames kept before the trigger, and everything from now on; does nothing if already triggered
+        void trigger();
+        frame_counts get_frame_counts(rs2_stream stream, int index) const;
+        rs2_record_queue_telemetry get_queue_telemetry() const;
         const std::string& get_filename() const;
         std::shared_ptr< const device_info > get_device_info() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
@@ -59,6 +97,21 @@ namespace librealsense
         void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
+        void keep_pre_trigger_frame(const device_serializer::stream_identifier& stream_id, std::chrono::nanoseconds capture_time,
+                                    frame_holder&& frame, std::function<void(std::string const&)> on_error);
+        std::chrono::nanoseconds get_record_time(std::chrono::nanoseconds capture_time) const;
+
+        // A frame waiting to be written
+        struct queued_frame
+        {
+            frame_holder frame;     // empty once dropped
+            std::pair<rs2_stream, int> stream;
+            uint64_t size;
+            int priority;
+            std::chrono::steady_clock::time_point arrival;
+        };
+        bool admit_frame(std::unique_lock<std::mutex>& lock, const queued_frame& frame, std::vector<frame_holder>& dropped);
+        frame_holder dequeue_frame(queued_frame& frame);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
         template <typename T> device_serializer::snapshot_collection get_extensions_snapshots(T* extendable);
         template <typename T, typename Ext> void try_add_snapshot(T* extendable, device_serializer::snapshot_collection& snapshots);
@@ -72,12 +125,38 @@ namespace librealsense
         std::chrono::high_resolution_clock::duration m_record_total_pause_duration;
         std::chrono::high_resolution_clock::time_point m_time_of_pause;
 
-        std::mutex m_mutex;
+        // All below are guarded by m_mutex
+        record_queue_settings m_queue;
+        std::deque<std::shared_ptr<queued_frame>> m_queued_frames;     // oldest first
+        uint64_t m_queued_size;                                         // of their data
+        uint64_t m_max_queued_size;
+        std::chrono::nanoseconds m_last_latency;
+        std::chrono::nanoseconds m_max_latency;
+        std::map<std::pair<rs2_stream, int>, frame_counts> m_frame_counts;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_queue_cv;     // room in the queue
+
         bool m_is_recording;
         std::once_flag m_first_frame_flag;
-        uint64_t m_cached_data_size;
         std::once_flag m_first_call_flag;
         void initialize_recording();
+
+        // A frame kept before the trigger
+        struct pre_trigger_frame
+        {
+            device_serializer::stream_identifier stream_id;
+            std::chrono::nanoseconds capture_time;
+            frame_holder frame;
+            uint64_t size;
+            std::function<void(std::string const&)> on_error;
+        };
+        // All below are accessed only from m_write_thread
+        std::chrono::nanoseconds m_pre_trigger;
+        uint64_t m_pre_trigger_memory_limit;
+        std::deque<pre_trigger_frame> m_pre_trigger_frames;    // oldest first
+        uint64_t m_pre_trigger_size;                            // of their data
+        bool m_triggered;
+        std::chrono::nanoseconds m_record_time_base;            // capture time of the first frame written, once triggered
     };
 
     MAP_EXTENSION(RS2_EXTENSION_RECORD, record_device);
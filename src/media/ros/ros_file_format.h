@@ -284,6 +284,11 @@ namespace librealsense
         {
             return create_from({ "file_version" });
         }
+        // The format of the video frames, when written next to the bag rather than in it (see raw_file_format)
+        static std::string frames_format_topic()
+        {
+            return create_from({ "frames_format" });
+        }
         static std::string device_info_topic(uint32_t device_id)
         {
             return create_from({ device_prefix(device_id),  "info" });
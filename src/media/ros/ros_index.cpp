@@ -0,0 +1,227 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "ros_index.h"
+#include "ros_file_format.h"
+#include "rosbag/view.h"
+
+#include <rsutils/string/from.h>
+#include <rsutils/number/crc32.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace librealsense
+{
+    using namespace device_serializer;
+
+    namespace
+    {
+        char const index_magic[8] = { 'R', 'S', 'B', 'A', 'G', 'I', 'D', 'X' };
+        uint32_t const index_version = 2;
+        uint32_t const index_byte_order = 0x01020304;  // written as is, so a file from a machine of another endianness is ignored
+
+        template< class T >
+        void write( std::ostream & out, T const & value )
+        {
+            out.write( reinterpret_cast< char const * >( &value ), sizeof( value ) );
+        }
+
+        template< class T >
+        T read( std::istream & in )
+        {
+            T value;
+            if( ! in.read( reinterpret_cast< char * >( &value ), sizeof( value ) ) )
+                throw io_exception( "index is truncated" );
+            return value;
+        }
+
+        // The bag is identified by its size and a checksum of its first and last CHECKSUM_SPAN bytes: a bag rewritten
+        // with the same size but other content has another header, or other chunk times
+        size_t const CHECKSUM_SPAN = 4096;
+
+        uint32_t bag_checksum_of( std::istream & bag, uint64_t bag_size )
+        {
+            auto const head = size_t( std::min< uint64_t >( CHECKSUM_SPAN, bag_size ) );
+            auto const tail = size_t( std::min< uint64_t >( CHECKSUM_SPAN, bag_size - head ) );
+            std::vector< char > data( head + tail );
+            bag.seekg( 0 );
+            bag.read( data.data(), head );
+            bag.seekg( bag_size - tail );
+            bag.read( data.data() + head, tail );
+            if( ! bag )
+                throw io_exception( "failed to read the bag" );
+            return rsutils::number::calc_crc32( reinterpret_cast< uint8_t const * >( data.data() ), data.size() );
+        }
+    }
+
+    bool ros_index::load( const std::string & bag_file )
+    {
+        std::ifstream in( file_name( bag_file ), std::ios::binary );
+        std::ifstream bag( bag_file, std::ios::binary | std::ios::ate );
+        if( ! in || ! bag )
+            return false;
+        uint64_t const actual_bag_size = bag.tellg();
+
+        try
+        {
+            char magic[sizeof( index_magic )];
+            if( ! in.read( magic, sizeof( magic ) ) || memcmp( magic, index_magic, sizeof( index_magic ) )
+                || read< uint32_t >( in ) != index_version || read< uint32_t >( in ) != index_byte_order )
+            {
+                LOG_WARNING( "Ignoring " << file_name( bag_file ) << ": not a bag index, or of an unsupported version" );
+                return false;
+            }
+
+            bag_size = read< uint64_t >( in );
+            bag_checksum = read< uint32_t >( in );
+            if( bag_size != actual_bag_size || bag_checksum != bag_checksum_of( bag, actual_bag_size ) )
+            {
+                LOG_INFO( "Ignoring " << file_name( bag_file ) << ": the bag changed since it was indexed" );
+                return false;
+            }
+
+            connection_indexes.clear();
+            for( auto connections = read< uint32_t >( in ); connections; --connections )
+            {
+                auto & index = connection_indexes[read< uint32_t >( in )];
+                for( auto count = read< uint32_t >( in ); count; --count )
+                {
+                    rosbag::IndexEntry entry;
+                    auto const sec = read< uint32_t >( in );
+                    auto const nsec = read< uint32_t >( in );
+                    entry.time = rs2rosinternal::Time( sec, nsec );
+                    entry.chunk_pos = read< uint64_t >( in );
+                    entry.offset = read< uint32_t >( in );
+                    index.insert( index.end(), entry );
+                }
+            }
+
+            frames.clear();
+            for( auto streams = read< uint32_t >( in ); streams; --streams )
+            {
+                stream_identifier stream_id;
+                stream_id.device_index = read< uint32_t >( in );
+                stream_id.sensor_index = read< uint32_t >( in );
+                stream_id.stream_type = rs2_stream( read< uint32_t >( in ) );
+                stream_id.stream_index = read< uint32_t >( in );
+                auto & stream = frames[stream_id];
+                auto const count = read< uint32_t >( in );
+                bool const has_frame_numbers = read< uint8_t >( in ) != 0;
+                for( uint32_t i = 0; i < count; ++i )
+                    stream.timestamps.emplace_back( read< int64_t >( in ) );
+                if( has_frame_numbers )
+                    for( uint32_t i = 0; i < count; ++i )
+                        stream.frame_numbers.push_back( read< uint64_t >( in ) );
+            }
+        }
+        catch( const std::exception & e )
+        {
+            LOG_WARNING( "Ignoring " << file_name( bag_file ) << ": " << e.what() );
+            connection_indexes.clear();
+            frames.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void ros_index::save( const std::string & bag_file,
+                          const std::map< uint32_t, std::multiset< rosbag::IndexEntry > > & bag_connection_indexes ) const
+    {
+        auto const path = file_name( bag_file );
+        std::ofstream out( path, std::ios::binary | std::ios::trunc );
+        if( ! out )
+            throw io_exception( rsutils::string::from() << "Failed to create " << path );
+
+        out.write( index_magic, sizeof( index_magic ) );
+        write( out, index_version );
+        write( out, index_byte_order );
+        write( out, bag_size );
+        write( out, bag_checksum );
+
+        write( out, uint32_t( bag_connection_indexes.size() ) );
+        for( auto & index : bag_connection_indexes )
+        {
+            write( out, index.first );
+            write( out, uint32_t( index.second.size() ) );
+            for( auto & entry : index.second )
+            {
+                write( out, entry.time.sec );
+                write( out, entry.time.nsec );
+                write( out, entry.chunk_pos );
+                write( out, entry.offset );
+            }
+        }
+
+        write( out, uint32_t( frames.size() ) );
+        for( auto & stream : frames )
+        {
+            write( out, stream.first.device_index );
+            write( out, stream.first.sensor_index );
+            write( out, uint32_t( stream.first.stream_type ) );
+            write( out, stream.first.stream_index );
+            write( out, uint32_t( stream.second.timestamps.size() ) );
+            write( out, uint8_t( stream.second.frame_numbers.empty() ? 0 : 1 ) );
+            for( auto & timestamp : stream.second.timestamps )
+                write( out, int64_t( timestamp.count() ) );
+            for( auto frame_number : stream.second.frame_numbers )
+                write( out, uint64_t( frame_number ) );
+        }
+
+        if( ! out.flush() )
+            throw io_exception( rsutils::string::from() << "Failed to write " << path );
+    }
+
+    void ros_index::build( const rosbag::Bag & bag, frame_numbers_by_stream frame_numbers )
+    {
+        bag_size = bag.getSize();
+        std::ifstream bag_file( bag.getFileName(), std::ios::binary );
+        if( ! bag_file )
+            throw io_exception( rsutils::string::from() << "Failed to open " << bag.getFileName() );
+        bag_checksum = bag_checksum_of( bag_file, bag_size );
+        auto & bag_connection_indexes = bag.getConnectionIndexes();
+        frames.clear();
+
+        rosbag::View frames_view( bag, FrameQuery() );
+        for( auto connection : frames_view.getConnections() )
+        {
+            auto index = bag_connection_indexes.find( connection->id );
+            if( index == bag_connection_indexes.end() )
+                continue;
+
+            auto stream_id = ros_topic::get_stream_identifier( connection->topic );
+            auto & stream = frames[stream_id];
+            for( auto & entry : index->second )
+                stream.timestamps.push_back( to_nanoseconds( entry.time ) );
+
+            // The bag's index is in time order, frames with the same time in the order they were written
+            auto numbers = frame_numbers.find( stream_id );
+            if( numbers != frame_numbers.end() && numbers->second.size() == stream.timestamps.size() )
+            {
+                std::stable_sort( numbers->second.begin(),
+                                  numbers->second.end(),
+                                  []( std::pair< nanoseconds, unsigned long long > const & a,
+                                      std::pair< nanoseconds, unsigned long long > const & b )
+                                  { return a.first < b.first; } );
+                for( auto & number : numbers->second )
+                    stream.frame_numbers.push_back( number.second );
+            }
+        }
+    }
+
+    bool ros_index::last_frame_at( const stream_identifier & stream_id,
+                                   const nanoseconds & time,
+                                   nanoseconds & timestamp ) const
+    {
+        auto stream = frames.find( stream_id );
+        if( stream == frames.end() )
+            return false;
+        auto & timestamps = stream->second.timestamps;
+        auto after = std::upper_bound( timestamps.begin(), timestamps.end(), time );
+        if( after == timestamps.begin() )
+            return false;
+        timestamp = *--after;
+        return true;
+    }
+}
@@ -0,0 +1,66 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <core/serialization.h>
+#include "rosbag/bag.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace librealsense
+{
+    /*
+        The index of a bag, kept next to it in <bag>.idx so it needn't be read from the bag every time it's opened:
+        - The bag's own index of every message (its time, chunk and offset in the chunk), by connection. The bag then
+          opens without reading the index records that follow each of its chunks, which for a long recording are
+          spread all over the file.
+        - The timestamp, and frame number when known, of every frame by stream, for finding frames in O(log n).
+        The bag's size, and a checksum of its first and last few KB (its header, and the connection and chunk records
+        at its end, with the times of every chunk), are kept with it; an index that doesn't match its bag is ignored.
+    */
+    class ros_index
+    {
+    public:
+        struct stream_frames
+        {
+            std::vector< device_serializer::nanoseconds > timestamps;  // in order
+            std::vector< unsigned long long > frame_numbers;            // for each timestamp; empty if not known
+            // (frame number, i) for each frame, by frame number then i; not saved, made on the first lookup by number
+            std::vector< std::pair< unsigned long long, size_t > > by_frame_number;
+        };
+
+        // Frame numbers of the frames of each stream, in the order they were written
+        typedef std::map< device_serializer::stream_identifier,
+                          std::vector< std::pair< device_serializer::nanoseconds, unsigned long long > > >
+            frame_numbers_by_stream;
+
+        static std::string file_name( const std::string & bag_file ) { return bag_file + ".idx"; }
+
+        // Reads the index of the given bag; returns false if there is none, or it's out of date
+        bool load( const std::string & bag_file );
+
+        // Writes the index next to the given bag, with the bag's own index of its messages; throws io_exception
+        void save( const std::string & bag_file,
+                   const std::map< uint32_t, std::multiset< rosbag::IndexEntry > > & bag_connection_indexes ) const;
+
+        // Indexes the frames of a bag open for reading, in the current file format. Frames of streams whose frame
+        // numbers are given, as written, get them. The bag's own index of its messages is left to the bag.
+        void build( const rosbag::Bag & bag, frame_numbers_by_stream frame_numbers = {} );
+
+        // Timestamp of the last frame of the stream at or before the given time; false if there's none or the stream
+        // isn't indexed
+        bool last_frame_at( const device_serializer::stream_identifier & stream_id,
+                            const device_serializer::nanoseconds & time,
+                            device_serializer::nanoseconds & timestamp ) const;
+
+        uint64_t bag_size = 0;
+        uint32_t bag_checksum = 0;
+        std::map< uint32_t, std::multiset< rosbag::IndexEntry > > connection_indexes;  // as loaded, to open the bag with
+        std::map< device_serializer::stream_identifier, stream_frames > frames;
+    };
+}
@@ -10,9 +10,11 @@
 #include <src/core/motion-frame.h>
 #include <src/core/video-frame.h>
 #include <src/color-sensor.h>
+#include <src/proc/rvl-codec.h>
 
 #include <rsutils/string/from.h>
 #include <cstring>
+#include <thread>
 
 
 namespace librealsense
@@ -25,12 +27,18 @@ namespace librealsense
         m_file_path(file),
         m_context(ctx),
         m_version(0),
-        m_legacy_depth_units(0)
+        m_legacy_depth_units(0),
+        m_indexed(false)
     {
         try
         {
+            set_max_throughput(false);
+            m_indexed = m_index.load(file);
             reset(); //Note: calling a virtual function inside c'tor, safe while base function is pure virtual
             m_total_duration = get_file_duration(m_file, m_version);
+            // Otherwise, the index is built once frames are first looked up
+            if (!m_indexed && write_index())
+                index_file();
         }
         catch (const std::exception& e)
         {
@@ -44,6 +52,16 @@ namespace librealsense
         return read_device_description(time);
     }
 
+    void ros_reader::set_max_throughput(bool max_throughput)
+    {
+        // Chunks following the one being read are decompressed by a pool of workers: a few are plenty to keep up
+        // with real time, while reading as fast as possible uses them all
+        auto const cores = std::max( 1u, std::thread::hardware_concurrency() );
+        auto threads = max_throughput ? cores : std::min( 4u, std::max( 1u, cores / 2 ) );
+        m_file.setReadAhead( threads );
+        LOG_DEBUG( "Reading ahead with " << threads << " threads" );
+    }
+
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
     {
         if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
@@ -121,11 +139,20 @@ namespace librealsense
         auto as_rostime = to_rostime(seek_time);
         auto start_time = to_rostime(get_static_file_info_timestamp());
 
+        // Indexed streams are looked up; others are scanned from the start
+        std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
         for (auto topic : m_enabled_streams_topics)
         {
-            view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
+            auto id = ros_topic::get_stream_identifier(topic);
+            if (m_version != legacy_file_format::file_version() && indexed_frames(id))
+            {
+                nanoseconds timestamp;
+                if (m_index.last_frame_at(id, seek_time, timestamp) && timestamp >= get_static_file_info_timestamp())
+                    last_frames[id] = to_rostime(timestamp);
+            }
+            else
+                view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
         }
-        std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
         for (auto&& m : view)
         {
             if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
@@ -139,20 +166,177 @@ namespace librealsense
             auto topic = ros_topic::frame_data_topic(kvp.first);
             rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
             auto msg = view.begin();
+            if (msg == view.end() || !((*msg).isType<sensor_msgs::Image>() || (*msg).isType<sensor_msgs::Imu>()))
+                continue;
             auto new_frame = create_frame(*msg);
             result.push_back(new_frame);
         }
         return result;
     }
+
+    ros_index::stream_frames* ros_reader::indexed_frames(const stream_identifier& stream_id)
+    {
+        if (m_version == legacy_file_format::file_version())
+            throw not_implemented_exception("Random access to frames is not supported for files of this (legacy) format");
+        if (!m_indexed)
+            index_file();
+        auto stream = m_index.frames.find(stream_id);
+        if (stream == m_index.frames.end() || stream->second.timestamps.empty())
+            return nullptr;
+        return &stream->second;
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::read_indexed_frame(const stream_identifier& stream_id,
+                                                                     const ros_index::stream_frames& frames,
+                                                                     size_t i)
+    {
+        // Frames with the same time are in the order they were written, both in the index and in the view
+        auto timestamp = frames.timestamps[i];
+        auto skip = i - (std::lower_bound(frames.timestamps.begin(), frames.timestamps.end(), timestamp) - frames.timestamps.begin());
+        auto as_rostime = to_rostime(timestamp);
+        rosbag::View view(m_file, rosbag::TopicQuery(ros_topic::frame_data_topic(stream_id)), as_rostime, as_rostime);
+        auto msg = view.begin();
+        for (; msg != view.end() && skip; --skip)
+            ++msg;
+        if (msg == view.end())
+            throw io_exception(rsutils::string::from() << "Frame of " << stream_id << " at " << timestamp.count() << " ns is missing from the file");
+        auto frame = create_frame(*msg);
+        if (!frame->frame)
+            throw io_exception("Failed to allocate a frame; too many frames of the stream may be held");
+        return frame;
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::read_frame(const stream_identifier& stream_id, unsigned long long frame_number)
+    {
+        auto frames = indexed_frames(stream_id);
+        if (!frames)
+            return nullptr;
+        if (frames->frame_numbers.empty())
+        {
+            // Frame numbers not written to the index are read once from the frames themselves
+            LOG_DEBUG("Reading the frame numbers of " << stream_id);
+            rosbag::View view(m_file, rosbag::TopicQuery(ros_topic::frame_data_topic(stream_id)));
+            std::vector<unsigned long long> frame_numbers;
+            frame_numbers.reserve(frames->timestamps.size());
+            for (auto&& msg : view)
+                frame_numbers.push_back(read_frame_number(msg));
+            if (frame_numbers.size() != frames->timestamps.size())
+                throw io_exception(rsutils::string::from() << "Index of " << stream_id << " doesn't match the file");
+            frames->frame_numbers = std::move(frame_numbers);
+        }
+        auto& by_number = frames->by_frame_number;
+        if (by_number.empty())
+        {
+            by_number.reserve(frames->frame_numbers.size());
+            for (size_t i = 0; i < frames->frame_numbers.size(); ++i)
+                by_number.emplace_back(frames->frame_numbers[i], i);
+            std::sort(by_number.begin(), by_number.end());
+        }
+        // Frame numbers may restart within a recording: the first frame with the number is the one taken
+        auto it = std::lower_bound(by_number.begin(), by_number.end(), std::make_pair(frame_number, size_t(0)));
+        if (it == by_number.end() || it->first != frame_number)
+            return nullptr;
+        return read_indexed_frame(stream_id, *frames, it->second);
+    }
+
+    unsigned long long ros_reader::read_frame_number(const rosbag::MessageInstance& msg) const
+    {
+        // Images and motion samples have it in the seq of their header, which is the first thing in the message: the
+        // rest, with the image data, isn't read. Poses have it in their metadata.
+        if (msg.isType<sensor_msgs::Image>() || msg.isType<sensor_msgs::Imu>())
+        {
+            uint8_t buffer[sizeof(uint32_t)];
+            if (msg.readPrefix(buffer, sizeof(buffer)) != sizeof(buffer))
+                throw io_exception(rsutils::string::from() << "Invalid frame message in " << msg.getTopic());
+            uint32_t seq;
+            rs2rosinternal::serialization::IStream stream(buffer, sizeof(buffer));
+            stream.next(seq);
+            return seq;
+        }
+        auto stream_id = ros_topic::get_stream_identifier(msg.getTopic());
+        rosbag::View metadata_view(m_file, rosbag::TopicQuery(ros_topic::frame_metadata_topic(stream_id)), msg.getTime(), msg.getTime());
+        for (auto&& metadata : metadata_view)
+        {
+            auto key_val_msg = instantiate_msg<diagnostic_msgs::KeyValue>(metadata);
+            if (key_val_msg->key == FRAME_NUMBER_MD_STR)
+                return std::stoull(key_val_msg->value);
+        }
+        return 0;
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::read_frame_at(const stream_identifier& stream_id, const nanoseconds& time)
+    {
+        auto frames = indexed_frames(stream_id);
+        if (!frames)
+            return nullptr;
+        auto& timestamps = frames->timestamps;
+        auto after = std::lower_bound(timestamps.begin(), timestamps.end(), time);
+        if (after == timestamps.end() || (after != timestamps.begin() && time - *std::prev(after) <= *after - time))
+            after = std::lower_bound(timestamps.begin(), after, *std::prev(after));
+        return read_indexed_frame(stream_id, *frames, after - timestamps.begin());
+    }
+
+    std::string ros_reader::frames_format() const
+    {
+        rosbag::View view(m_file, rosbag::TopicQuery(ros_topic::frames_format_topic()));
+        for (auto&& msg : view)
+            return instantiate_msg<std_msgs::String>(msg)->data;
+        return {};
+    }
+
     nanoseconds ros_reader::query_duration() const
     {
         return m_total_duration;
     }
 
+    void ros_reader::index_file()
+    {
+        // Frames are looked up in the index whether or not it's kept for the next time the file is opened
+        m_index.build(m_file);
+        m_indexed = true;
+        if (write_index())
+        {
+            try
+            {
+                m_index.save(m_file_path, m_file.getConnectionIndexes());
+                LOG_INFO("Wrote " << ros_index::file_name(m_file_path));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Failed to write the index of " << m_file_path << ": " << e.what());
+            }
+        }
+    }
+
+    bool ros_reader::write_index() const
+    {
+        return m_context && m_context->get_settings().nested("playback-index").default_value(false);
+    }
+
     void ros_reader::reset()
     {
+        // The bag's index is handed over to the reopened file rather than kept twice: it's taken from the file when
+        // it's open, and from the index file the first time
+        auto connection_indexes = m_file.getConnectionIndexes();
+        if (connection_indexes.empty())
+            connection_indexes = std::move(m_index.connection_indexes);
+        m_index.connection_indexes.clear();
         m_file.close();
-        m_file.open(m_file_path, rosbag::BagMode::Read);
+        if (m_indexed)
+        {
+            try
+            {
+                m_file.open(m_file_path, std::move(connection_indexes));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Ignoring " << ros_index::file_name(m_file_path) << ": " << e.what());
+                m_indexed = false;
+                m_index = ros_index();
+            }
+        }
+        if (!m_indexed)
+            m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
         m_samples_view = nullptr;
         m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
@@ -336,6 +520,7 @@ namespace librealsense
                     total_md_size += static_cast<uint32_t>(size_of_data);
                 }
             }
+            additional_data.metadata_size = total_md_size;
 
             try
             {
@@ -405,10 +590,44 @@ namespace librealsense
         return remaining;
     }
 
+    // Reads an image message in place in a mapped bag (see rosbag::MessageInstance::getMappedData), pointing at its
+    // data rather than copying it into the message. Follows the layout of the message's Serializer.
+    static sensor_msgs::Image::ConstPtr read_image_in_place(const uint8_t * serialized, uint32_t size,
+                                                            const uint8_t *& data, uint32_t & data_size)
+    {
+        auto msg = std::make_shared< sensor_msgs::Image >();
+        rs2rosinternal::serialization::IStream stream(const_cast<uint8_t *>(serialized), size);
+        stream.next(msg->header);
+        stream.next(msg->height);
+        stream.next(msg->width);
+        stream.next(msg->encoding);
+        stream.next(msg->is_bigendian);
+        stream.next(msg->step);
+        stream.next(data_size);
+        data = stream.advance(data_size);
+        if (!msg->header.version.compare("1"))
+            stream.next(msg->depth_units);
+        return msg;
+    }
+
     frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
-        auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
+        // Frames of a mapped bag take their data straight from the mapping, which they keep alive
+        sensor_msgs::Image::ConstPtr msg;
+        const uint8_t * serialized;
+        uint32_t serialized_size;
+        std::shared_ptr<void const> mapping;
+        const uint8_t * data = nullptr;
+        uint32_t data_size = 0;
+        if (image_data.isType<sensor_msgs::Image>() && image_data.getMappedData(serialized, serialized_size, mapping))
+            msg = read_image_in_place(serialized, serialized_size, data, data_size);
+        else
+        {
+            msg = instantiate_msg<sensor_msgs::Image>(image_data);
+            data = msg->data.data();
+            data_size = uint32_t(msg->data.size());
+        }
         frame_additional_data additional_data{};
         std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
         additional_data.timestamp = timestamp_ms.count();
@@ -434,11 +653,18 @@ namespace librealsense
             get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
         }
 
+        rs2_format stream_format;
+        convert(msg->encoding, stream_format);
+        // Depth recorded RVL-encoded is decoded into the frame, rather than taking the message data
+        bool const decode_depth = stream_format == RS2_FORMAT_Z16RVL;
+        size_t const decoded_size = size_t(msg->width) * msg->height * sizeof(uint16_t);
+
+        bool const in_place = mapping && !decode_depth;
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
-            msg->data.size(),
+            decode_depth ? decoded_size : in_place ? 0 : data_size,
             std::move( additional_data ),
-            true );
+            !in_place );
 
         if (frame == nullptr)
         {
@@ -446,16 +672,22 @@ namespace librealsense
             return nullptr;
         }
         librealsense::video_frame* video_frame = static_cast<librealsense::video_frame*>(frame);
+        librealsense::frame_holder fh{ video_frame };  // released if decoding throws
         video_frame->assign(msg->width, msg->height, msg->step, msg->step / msg->width * 8);
-        rs2_format stream_format;
-        convert(msg->encoding, stream_format);
+        if (decode_depth)
+        {
+            rvl::decode(data, data_size, (uint16_t*)video_frame->data.data(), size_t(msg->width) * msg->height);
+            stream_format = RS2_FORMAT_Z16;
+        }
+        else if (in_place)
+            video_frame->attach_continuation(frame_continuation([mapping]() {}, data, data_size));
+        else
+            memcpy(video_frame->data.data(), data, data_size);
         //attaching a temp stream to the frame. Playback sensor should assign the real stream
         frame->set_stream( std::make_shared< video_stream_profile >() );
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
-        librealsense::frame_holder fh{ video_frame };
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
         return fh;
@@ -6,6 +6,7 @@
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
+#include "ros_index.h"
 
 #include <rsutils/string/from.h>
 
@@ -34,6 +35,11 @@ namespace librealsense
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
+        void set_max_throughput(bool max_throughput) override;
+        std::shared_ptr<serialized_frame> read_frame(const stream_identifier& stream_id, unsigned long long frame_number) override;
+        std::shared_ptr<serialized_frame> read_frame_at(const stream_identifier& stream_id, const nanoseconds& time) override;
+        // The format video frames were recorded in, if not in the bag itself (see ros_writer::write_frames_format)
+        std::string frames_format() const;
 
     private:
 
@@ -51,7 +57,12 @@ namespace librealsense
             return msg_instnance_ptr;
         }
 
+        void index_file();
+        bool write_index() const;  // Whether an index is written next to a file that has none
+        ros_index::stream_frames* indexed_frames(const stream_identifier& stream_id);
+        std::shared_ptr<serialized_frame> read_indexed_frame(const stream_identifier& stream_id, const ros_index::stream_frames& frames, size_t i);
         std::shared_ptr<serialized_frame> create_frame(const rosbag::MessageInstance& msg);
+        unsigned long long read_frame_number(const rosbag::MessageInstance& msg) const;
         static nanoseconds get_file_duration(const rosbag::Bag& file, uint32_t version);
         static void get_legacy_frame_metadata(const rosbag::Bag& bag,
             const device_serializer::stream_identifier& stream_id,
@@ -137,5 +148,7 @@ namespace librealsense
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
         float                                   m_legacy_depth_units;
+        ros_index                               m_index;
+        bool                                    m_indexed;
     };
 }
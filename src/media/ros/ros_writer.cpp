@@ -9,29 +9,63 @@
 #include "proc/hole-filling-filter.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
+#include "proc/rvl-codec.h"
 #include "ros_writer.h"
 #include "core/pose-frame.h"
 #include "core/motion-frame.h"
 #include <src/core/sensor-interface.h>
 #include <src/core/device-interface.h>
+#include <src/tracing.h>
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace librealsense
 {
     using namespace device_serializer;
 
-    ros_writer::ros_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
+    ros_writer::ros_writer(const std::string& file, bool compress_while_record, bool encode_depth, bool write_index)
+        : m_file_path(file)
+        , m_encode_depth(encode_depth)
+        , m_write_index(write_index)
     {
-        LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
+        LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF")
+                 << (encode_depth ? ", depth is RVL-encoded" : ""));
         m_bag.open(file, rosbag::BagMode::Write);
         if (compress_while_record)
         {
             m_bag.setCompression(rosbag::CompressionType::LZ4);
+            // Chunks are compressed by a pool of workers, leaving the record thread to serialize the messages
+            auto threads = std::min( 4u, std::max( 1u, std::thread::hardware_concurrency() / 2 ) );
+            m_bag.setCompressionThreads( threads );
+            LOG_DEBUG( "Compressing with " << threads << " threads" );
         }
         write_file_version();
     }
 
+    ros_writer::~ros_writer()
+    {
+        if (!m_write_index)
+            return;
+        try
+        {
+            // The bag's index is complete once it's closed
+            m_bag.close();
+            rosbag::Bag bag;
+            bag.open(m_file_path, rosbag::BagMode::Read);
+            ros_index index;
+            index.build(bag, std::move(m_frame_numbers));
+            index.save(m_file_path, bag.getConnectionIndexes());
+            LOG_INFO("Wrote " << ros_index::file_name(m_file_path));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Failed to write the index of " << m_file_path << ": " << e.what());
+        }
+    }
+
     void ros_writer::write_device_description(const librealsense::device_snapshot& device_description)
     {
         for (auto&& device_extension_snapshot : device_description.get_device_extensions_snapshots().get_snapshots())
@@ -50,6 +84,7 @@ namespace librealsense
 
     void ros_writer::write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
+        LRS_TRACE_SCOPE( "ros_writer write frame" );
         if (Is<video_frame>(frame.frame))
         {
             write_video_frame(stream_id, timestamp, std::move(frame));
@@ -91,6 +126,13 @@ namespace librealsense
         write_message(ros_topic::file_version_topic(), get_static_file_info_timestamp(), msg);
     }
 
+    void ros_writer::write_frames_format(const std::string& format)
+    {
+        std_msgs::String msg;
+        msg.data = format;
+        write_message(ros_topic::frames_format_topic(), get_static_file_info_timestamp(), msg);
+    }
+
     void ros_writer::write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
     {
         auto metadata_topic = ros_topic::frame_metadata_topic(stream_id);
@@ -183,11 +225,27 @@ namespace librealsense
         image.width = static_cast<uint32_t>(vid_frame->get_width());
         image.height = static_cast<uint32_t>(vid_frame->get_height());
         image.step = static_cast<uint32_t>(vid_frame->get_stride());
-        convert(vid_frame->get_stream()->get_format(), image.encoding);
+        auto format = vid_frame->get_stream()->get_format();
         image.is_bigendian = is_big_endian();
         auto size = vid_frame->get_stride() * vid_frame->get_height();
         auto p_data = vid_frame->get_frame_data();
-        image.data.assign(p_data, p_data + size);
+        if (m_encode_depth && format == RS2_FORMAT_Z16)
+        {
+            auto depth = rvl::pack(p_data, vid_frame->get_width(), vid_frame->get_height(), vid_frame->get_stride(), m_packed_depth);
+            size_t pixels = size_t(vid_frame->get_width()) * vid_frame->get_height();
+            if (m_encoded_depth.size() < rvl::max_encoded_size(pixels))
+                m_encoded_depth.resize(rvl::max_encoded_size(pixels));
+            auto encoded = rvl::encode(depth, pixels, m_encoded_depth.data(), m_encoded_depth.size());
+            image.data.assign(m_encoded_depth.data(), m_encoded_depth.data() + encoded);
+            // The reader decodes to packed rows
+            image.step = static_cast<uint32_t>(vid_frame->get_width() * sizeof(uint16_t));
+            format = RS2_FORMAT_Z16RVL;
+        }
+        else
+        {
+            image.data.assign(p_data, p_data + size);
+        }
+        convert(format, image.encoding);
         image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
         std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
         image.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
@@ -197,6 +255,7 @@ namespace librealsense
             image.depth_units = df->get_units();
         auto image_topic = ros_topic::frame_data_topic(stream_id);
         write_message(image_topic, timestamp, image);
+        index_frame(stream_id, timestamp, frame);
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
@@ -233,6 +292,7 @@ namespace librealsense
 
         auto topic = ros_topic::frame_data_topic(stream_id);
         write_message(topic, timestamp, imu_msg);
+        index_frame(stream_id, timestamp, frame);
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
@@ -283,6 +343,7 @@ namespace librealsense
         write_message(transform_topic, timestamp, transform);
         write_message(accel_topic, timestamp, accel);
         write_message(twist_topic, timestamp, twist);
+        index_frame(stream_id, timestamp, frame);
 
         // Write the pose confidence as metadata for the pose frame
         std::string md_topic = ros_topic::frame_metadata_topic(stream_id);
@@ -313,6 +374,12 @@ namespace librealsense
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
+    void ros_writer::index_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame)
+    {
+        if (m_write_index)
+            m_frame_numbers[stream_id].emplace_back(timestamp, frame.frame->get_frame_number());
+    }
+
     void ros_writer::write_stream_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<stream_profile_interface> profile)
     {
         realsense_msgs::StreamInfo stream_info_msg;
@@ -4,6 +4,7 @@
 #pragma once
 #include "rosbag/bag.h"
 #include "ros_file_format.h"
+#include "ros_index.h"
 
 #include <rsutils/string/from.h>
 
@@ -17,17 +18,23 @@ namespace librealsense
     class ros_writer: public writer
     {
     public:
-        explicit ros_writer(const std::string& file, bool compress_while_record);
+        // encode_depth: Z16 depth images are written RVL-encoded (as Z16RVL), which ros_reader decodes back to Z16
+        // write_index: the file's index is written next to it once it's closed (see ros_index)
+        explicit ros_writer(const std::string& file, bool compress_while_record, bool encode_depth = false, bool write_index = false);
+        ~ros_writer();
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
+        // Written with the first frame of each stream; public for writers of frames kept elsewhere (see raw_writer)
+        void write_extrinsics(const stream_identifier& stream_id, frame_interface* frame);
+        // Records that video frames are kept elsewhere, in the given format
+        void write_frames_format(const std::string& format);
 
     private:
         void write_file_version();
         void write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
-        void write_extrinsics(const stream_identifier& stream_id, frame_interface* frame);
         realsense_msgs::Notification to_notification_msg(const notification& n);
         void write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n) override;
         void write_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
@@ -36,6 +43,7 @@ namespace librealsense
         inline geometry_msgs::Vector3 to_vector3(const float3& f);
         inline geometry_msgs::Quaternion to_quaternion(const float4& f);
         void write_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void index_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame);
         void write_stream_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<stream_profile_interface> profile);
         void write_streaming_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<video_stream_profile_interface> profile);
         void write_streaming_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<motion_stream_profile_interface> profile);
@@ -82,5 +90,10 @@ namespace librealsense
         std::string m_file_path;
         rosbag::Bag m_bag;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
+        bool m_encode_depth;
+        std::vector<uint16_t> m_packed_depth;   // rows of depth images with padding
+        std::vector<uint8_t> m_encoded_depth;   // sized for the worst case, so it's not reallocated per frame
+        bool m_write_index;
+        ros_index::frame_numbers_by_stream m_frame_numbers;
     };
 }
@@ -33,7 +33,8 @@ namespace librealsense
         bool find( const frame & frm, rs2_metadata_type * p_value ) const override
         {
             const uint8_t * pos = frm.additional_data.metadata_blob.data();
-            while( pos <= frm.additional_data.metadata_blob.data() + frm.additional_data.metadata_blob.size() )
+            const uint8_t * const end = pos + frm.additional_data.metadata_size;
+            while( pos + sizeof( rs2_frame_metadata_value ) + sizeof( rs2_metadata_type ) <= end )
             {
                 const rs2_frame_metadata_value * type = reinterpret_cast<const rs2_frame_metadata_value *>(pos);
                 pos += sizeof( rs2_frame_metadata_value );
@@ -18,6 +18,8 @@ namespace librealsense
             _streams_to_sync_ids(streams_to_sync),
             _accepting(true)
         {
+            // The pipeline records the delivery of the framesets itself
+            set_trace_stages( RS2_FRAME_TRACE_STAGE_COUNT, RS2_FRAME_TRACE_STAGE_COUNT );
             set_processing_callback(
                 make_frame_processor_callback( [&]( frame_holder && frame, synthetic_source_interface * source )
                                                { handle_frame( std::move( frame ), source ); } ) );
@@ -102,12 +104,18 @@ namespace librealsense
 
         bool aggregator::dequeue(frame_holder* item, unsigned int timeout_ms)
         {
-            return _queue->dequeue(item, timeout_ms);
+            if (!_queue->dequeue(item, timeout_ms))
+                return false;
+            trace_frame(item->frame, RS2_FRAME_TRACE_STAGE_DELIVERY);
+            return true;
         }
 
         bool aggregator::try_dequeue(frame_holder* item)
         {
-            return _queue->try_dequeue(item);
+            if (!_queue->try_dequeue(item))
+                return false;
+            trace_frame(item->frame, RS2_FRAME_TRACE_STAGE_DELIVERY);
+            return true;
         }
 
         void aggregator::start()
@@ -120,5 +128,10 @@ namespace librealsense
             _accepting = false;
             _queue->stop();
         }
+
+        void aggregator::set_conflating(bool conflating)
+        {
+            _queue->set_conflating(conflating);
+        }
     }
 }
@@ -33,6 +33,8 @@ namespace librealsense
             bool try_dequeue(frame_holder* item);
             void start();
             void stop();
+            // Only the latest frameset is kept for wait_for_frames/poll_for_frames
+            void set_conflating(bool conflating);
         };
     }
 }
@@ -8,11 +8,71 @@
 #include "context.h"
 #include <rsutils/string/from.h>
 
+#include <sstream>
+#include <list>
+
 
 namespace librealsense
 {
     namespace pipeline
     {
+        // The resolved stream requests of a configuration on a device, so that restarting a pipeline with the same
+        // configuration does not have to search the device's stream profiles again. Shared by all pipelines; only the
+        // most recently used entries are kept.
+        class resolved_requests_cache
+        {
+        public:
+            static const size_t MAX_ENTRIES = 16;
+
+            static resolved_requests_cache & instance()
+            {
+                static resolved_requests_cache cache;
+                return cache;
+            }
+
+            bool find(const std::string& key, std::vector<stream_profile>& requests)
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                auto it = lookup(key);
+                if (it == _entries.end())
+                    return false;
+                _entries.splice(_entries.begin(), _entries, it);
+                requests = it->second;
+                return true;
+            }
+
+            void store(const std::string& key, std::vector<stream_profile> requests)
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                auto it = lookup(key);
+                if (it != _entries.end())
+                    _entries.erase(it);
+                _entries.emplace_front(key, std::move(requests));
+                if (_entries.size() > MAX_ENTRIES)
+                    _entries.pop_back();
+            }
+
+            void erase(const std::string& key)
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                auto it = lookup(key);
+                if (it != _entries.end())
+                    _entries.erase(it);
+            }
+
+        private:
+            typedef std::list<std::pair<std::string, std::vector<stream_profile>>> entries;
+
+            entries::iterator lookup(const std::string& key)
+            {
+                return std::find_if(_entries.begin(), _entries.end(),
+                                    [&](const entries::value_type& e) { return e.first == key; });
+            }
+
+            std::mutex _mtx;
+            entries _entries;  // Most recently used first
+        };
+
         config::config()
         {
             //empty
@@ -138,7 +198,71 @@ namespace librealsense
             return config;
         }
 
-        std::shared_ptr<profile> config::resolve(std::shared_ptr<device_interface> dev)
+        // Identifies the device (serial + firmware) and everything in this config that affects the resolution; empty
+        // if the device cannot be identified
+        std::string config::get_resolve_cache_key(std::shared_ptr<device_interface> dev) const
+        {
+            if (!dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER) || !dev->supports_info(RS2_CAMERA_INFO_FIRMWARE_VERSION))
+                return {};
+
+            std::ostringstream key;
+            key << dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER) << '/' << dev->get_info(RS2_CAMERA_INFO_FIRMWARE_VERSION)
+                << '/' << _device_request.filename << '/' << _device_request.record_output << '/' << _enable_all_streams;
+            for (auto&& req : _stream_requests)
+            {
+                auto& r = req.second;
+                key << '/' << r.stream << ':' << r.index << ':' << r.width << 'x' << r.height << ':' << r.format << '@' << r.fps;
+            }
+            for (auto&& st : _streams_to_disable)
+                key << "/-" << st.first << ':' << st.second;
+            return key.str();
+        }
+
+        std::shared_ptr<profile> config::resolve(std::shared_ptr<device_interface> dev, bool& from_cache)
+        {
+            from_cache = false;
+            auto key = get_resolve_cache_key(dev);
+            auto& cache = resolved_requests_cache::instance();
+            std::vector<stream_profile> requests;
+            if (!key.empty() && cache.find(key, requests))
+            {
+                try
+                {
+                    // The cached requests are complete (no wildcards), so nothing needs to be searched
+                    util::config config;
+                    for (auto&& r : requests)
+                        config.enable_stream(r.stream, r.index, r.width, r.height, r.format, r.fps);
+                    auto resolved = std::make_shared<profile>(dev, config, _device_request.record_output);
+                    from_cache = true;
+                    return resolved;
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_DEBUG("Cached pipeline configuration no longer resolves: " << e.what());
+                    cache.erase(key);
+                }
+            }
+
+            auto resolved = resolve_uncached(dev);
+            if (!key.empty())
+            {
+                requests.clear();
+                for (auto&& p : resolved->get_active_streams())
+                {
+                    stream_profile r(p->get_format(), p->get_stream_type(), p->get_stream_index(), 0, 0, p->get_framerate());
+                    if (auto vp = dynamic_cast<video_stream_profile_interface*>(p.get()))
+                    {
+                        r.width = vp->get_width();
+                        r.height = vp->get_height();
+                    }
+                    requests.push_back(r);
+                }
+                cache.store(key, std::move(requests));
+            }
+            return resolved;
+        }
+
+        std::shared_ptr<profile> config::resolve_uncached(std::shared_ptr<device_interface> dev)
         {
             util::config config;
             util::config filtered_config;
@@ -189,12 +313,13 @@ namespace librealsense
         {
             std::lock_guard<std::mutex> lock(_mtx);
             _resolved_profile.reset();
+            _resolved_from_cache = false;
 
             //Resolve the the device that was specified by the user, this call will wait in case the device is not availabe.
             auto requested_device = resolve_device_requests(pipe, timeout);
             if (requested_device != nullptr)
             {
-                _resolved_profile = resolve(requested_device);
+                _resolved_profile = resolve(requested_device, _resolved_from_cache);
                 return _resolved_profile;
             }
 
@@ -205,7 +330,7 @@ namespace librealsense
                 try
                 {
                     auto dev = dev_info->create_device();
-                    _resolved_profile = resolve(dev);
+                    _resolved_profile = resolve(dev, _resolved_from_cache);
                     return _resolved_profile;
                 }
                 catch (const std::exception& e)
@@ -218,7 +343,7 @@ namespace librealsense
             auto dev = pipe->wait_for_device(timeout);
             if (dev != nullptr)
             {
-                _resolved_profile = resolve(dev);
+                _resolved_profile = resolve(dev, _resolved_from_cache);
                 return _resolved_profile;
             }
 
@@ -334,5 +459,23 @@ namespace librealsense
         bool config::get_repeat_playback() {
             return _playback_loop;
         }
+
+        void config::set_conflating(bool conflating)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _conflating = conflating;
+        }
+
+        bool config::get_conflating()
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _conflating;
+        }
+
+        bool config::resolved_from_cache()
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _resolved_from_cache;
+        }
     }
 }
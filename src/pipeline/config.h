@@ -29,6 +29,10 @@ namespace librealsense
             std::shared_ptr<profile> resolve(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout = std::chrono::milliseconds(0));
             bool can_resolve(std::shared_ptr<pipeline> pipe);
             bool get_repeat_playback();
+            void set_conflating(bool conflating);
+            bool get_conflating();
+            // Whether the last resolve() reused the stream requests resolved earlier for the same device and config
+            bool resolved_from_cache();
 
             //Non top level API
             std::shared_ptr<profile> get_cached_resolved_profile();
@@ -41,6 +45,7 @@ namespace librealsense
                 _stream_requests = other._stream_requests;
                 _resolved_profile = nullptr;
                 _playback_loop = other._playback_loop;
+                _conflating = other._conflating;
             }
         private:
             struct device_request
@@ -52,7 +57,10 @@ namespace librealsense
             std::shared_ptr<device_interface> get_or_add_playback_device(std::shared_ptr<context> ctx, const std::string& file);
             std::shared_ptr<device_interface> resolve_device_requests(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout);
             stream_profiles get_default_configuration(std::shared_ptr<device_interface> dev);
-            std::shared_ptr<profile> resolve(std::shared_ptr<device_interface> dev);
+            // Sets from_cache if the stream requests resolved earlier for the same device and config were reused
+            std::shared_ptr<profile> resolve(std::shared_ptr<device_interface> dev, bool& from_cache);
+            std::shared_ptr<profile> resolve_uncached(std::shared_ptr<device_interface> dev);
+            std::string get_resolve_cache_key(std::shared_ptr<device_interface> dev) const;
             util::config filter_stream_requests(const stream_profiles& profiles) const;
 
             device_request _device_request;
@@ -61,6 +69,8 @@ namespace librealsense
             bool _enable_all_streams = false;
             std::shared_ptr<profile> _resolved_profile;
             bool _playback_loop = false;
+            bool _conflating = false;
+            bool _resolved_from_cache = false;  // Of the last resolve(pipe); guarded by _mtx
             std::vector<std::pair<rs2_stream, int>> _streams_to_disable;
         };
     }
@@ -60,8 +60,21 @@ namespace librealsense
             return _active_profile;
         }
 
+        rsutils::json pipeline::get_start_report() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _start_report;
+        }
+
         void pipeline::unsafe_start(std::shared_ptr<config> conf)
         {
+            using namespace std::chrono;
+            auto elapsed_ms = []( steady_clock::time_point since ) {
+                return duration< double, std::milli >( steady_clock::now() - since ).count();
+            };
+            auto const started = steady_clock::now();
+            bool resolved_from_cache = true;
+
             std::shared_ptr<profile> profile = nullptr;
             //first try to get the previously resolved profile (if exists)
             auto cached_profile = conf->get_cached_resolved_profile();
@@ -77,6 +90,7 @@ namespace librealsense
                     try
                     {
                         profile = conf->resolve(shared_from_this(), std::chrono::seconds(5));
+                        resolved_from_cache = conf->resolved_from_cache();
                         break;
                     }
                     catch (...)
@@ -87,11 +101,13 @@ namespace librealsense
                 }
             }
 
+            auto const resolve_ms = elapsed_ms( started );
+
             assert(profile);
             if (!profile->_multistream.get_profiles().size())
                 throw librealsense::wrong_api_call_sequence_exception("No streams are selected!");
 
-            auto synced_streams_ids = on_start(profile);
+            auto synced_streams_ids = on_start(profile, conf->get_conflating());
 
             rs2_frame_callback_sptr callbacks = get_callback(synced_streams_ids);
 
@@ -117,10 +133,32 @@ namespace librealsense
             }
 
             _dispatcher.start();
-            profile->_multistream.open();
+            // Sensors are opened concurrently only where the device and its backend allow it (e.g., the sensors of a
+            // recording share the file reader)
+            auto const opening = steady_clock::now();
+            auto open_ms = profile->_multistream.open( dev->supports_parallel_sensor_open() );
+            auto const open_total_ms = elapsed_ms( opening );
+            auto const starting = steady_clock::now();
             profile->_multistream.start(callbacks);
+            auto const start_ms = elapsed_ms( starting );
             _active_profile = profile;
             _prev_conf = std::make_shared<config>(*conf);
+
+            rsutils::json report;
+            report["resolve-ms"] = resolve_ms;
+            report["resolved-from-cache"] = resolved_from_cache;
+            report["open-ms"] = open_total_ms;
+            report["start-ms"] = start_ms;
+            report["total-ms"] = elapsed_ms( started );
+            auto & sensors = report["sensors"] = rsutils::json::array();
+            for( auto & so : open_ms )
+            {
+                auto name = so.first->supports_info( RS2_CAMERA_INFO_NAME ) ? so.first->get_info( RS2_CAMERA_INFO_NAME )
+                                                                            : std::string( "Unknown" );
+                sensors.push_back( { { "name", name }, { "open-ms", so.second } } );
+            }
+            LOG_INFO( "Pipeline started in " << report["total-ms"].get< double >() << " ms: " << report.dump() );
+            _start_report = std::move( report );
         }
 
         void pipeline::stop()
@@ -148,6 +186,11 @@ namespace librealsense
                     }
                     _active_profile->_multistream.stop();
                     _active_profile->_multistream.close();
+                    if (_callback_dispatcher)
+                    {
+                        _callback_dispatcher->stop();
+                        _callback_dispatcher.reset();
+                    }
                     _dispatcher.stop();
                 }
                 catch (...)
@@ -173,7 +216,7 @@ namespace librealsense
             return _ctx;
         }
 
-        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile)
+        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile, bool conflating)
         {
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
@@ -194,8 +237,42 @@ namespace librealsense
             _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
             _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids));
 
-            if (_streams_callback)
-                _aggregator->set_output_callback(_streams_callback);
+            _aggregator->set_conflating(conflating);
+
+            if (_streams_callback && conflating)
+            {
+                // A slow callback must not hold up the streams: it gets the latest frameset once it is done with
+                // the previous one, and whatever was superseded in the meantime is released right away
+                _callback_dispatcher = std::make_shared<dispatcher>(1);
+                _callback_dispatcher->start();
+                auto callback_dispatcher = _callback_dispatcher;
+                auto user_callback = _streams_callback;
+                _aggregator->set_output_callback( make_frame_callback(
+                    [callback_dispatcher, user_callback]( frame_holder fref )
+                    {
+                        auto fh = std::make_shared< frame_holder >( std::move( fref ) );
+                        callback_dispatcher->invoke(
+                            [user_callback, fh]( dispatcher::cancellable_timer const & )
+                            {
+                                frame_interface * ref = nullptr;
+                                std::swap( fh->frame, ref );
+                                trace_frame( ref, RS2_FRAME_TRACE_STAGE_DELIVERY );
+                                user_callback->on_frame( (rs2_frame *)ref );
+                            } );
+                    } ) );
+            }
+            else if (_streams_callback)
+            {
+                auto user_callback = _streams_callback;
+                _aggregator->set_output_callback( make_frame_callback(
+                    [user_callback]( frame_holder fref )
+                    {
+                        frame_interface * ref = nullptr;
+                        std::swap( fref.frame, ref );
+                        trace_frame( ref, RS2_FRAME_TRACE_STAGE_DELIVERY );
+                        user_callback->on_frame( (rs2_frame *)ref );
+                    } ) );
+            }
 
             return _streams_to_sync_ids;
         }
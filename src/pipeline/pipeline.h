@@ -13,6 +13,8 @@
 #include "resolver.h"
 #include "aggregator.h"
 
+#include <rsutils/json.h>
+
 namespace librealsense
 {
     class syncer_process_unit;
@@ -31,6 +33,8 @@ namespace librealsense
             frame_holder wait_for_frames(unsigned int timeout_ms);
             bool poll_for_frames(frame_holder* frame);
             bool try_wait_for_frames(frame_holder* frame, unsigned int timeout_ms);
+            // How long the last start() spent resolving the configuration, opening each sensor and starting streaming
+            rsutils::json get_start_report() const;
 
             //Non top level API
             std::shared_ptr<device_interface> wait_for_device(const std::chrono::milliseconds& timeout = std::chrono::hours::max(),
@@ -39,7 +43,7 @@ namespace librealsense
 
         protected:
             rs2_frame_callback_sptr get_callback(std::vector<int> unique_ids);
-            std::vector<int> on_start(std::shared_ptr<profile> profile);
+            std::vector<int> on_start(std::shared_ptr<profile> profile, bool conflating);
 
             void unsafe_start(std::shared_ptr<config> conf);
             void unsafe_stop();
@@ -60,7 +64,10 @@ namespace librealsense
             std::unique_ptr<aggregator> _aggregator;
 
             rs2_frame_callback_sptr _streams_callback;
+            // When conflating, the user callback runs on its own thread and only ever gets the latest frameset
+            std::shared_ptr<dispatcher> _callback_dispatcher;
             std::vector<rs2_stream> _synced_streams;
+            rsutils::json _start_report;
         };
     }
 }
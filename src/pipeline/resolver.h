@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <cmath>
 #include <set>
+#include <thread>
+#include <chrono>
 #include "sensor.h"
 #include "types.h"
 #include "stream.h"
@@ -134,12 +136,87 @@ namespace librealsense
                             _results(std::move(results))
                 {}
 
-                void open()
+                // Opens all the sensors, concurrently if 'parallel' is set (see device_interface::
+                // supports_parallel_sensor_open), and returns how long each took to open in
+                // milliseconds. If any sensor fails to open, the ones that were opened are closed again.
+                std::map<sensor_interface*, double> open(bool parallel = false)
                 {
-                    for (auto && kvp : _dev_to_profiles) {
-                        auto&& sub = _results.at(kvp.first);
-                        sub->open(kvp.second);
+                    struct sensor_open
+                    {
+                        sensor_interface* sensor;
+                        const stream_profiles* profiles;
+                        bool opened = false;
+                        std::exception_ptr error;
+                        double ms = 0;
+                    };
+                    std::vector<sensor_open> sensors;
+                    for (auto && kvp : _dev_to_profiles)
+                    {
+                        sensor_open so;
+                        so.sensor = _results.at(kvp.first);
+                        so.profiles = &kvp.second;
+                        sensors.push_back(so);
+                    }
+
+                    auto open_sensor = [](sensor_open& so)
+                    {
+                        auto started = std::chrono::steady_clock::now();
+                        try
+                        {
+                            so.sensor->open(*so.profiles);
+                            so.opened = true;
+                        }
+                        catch (...)
+                        {
+                            so.error = std::current_exception();
+                        }
+                        so.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+                    };
+
+                    std::exception_ptr error;
+                    if (parallel && sensors.size() > 1)
+                    {
+                        std::vector<std::thread> threads;
+                        for (size_t i = 1; i < sensors.size(); ++i)
+                            threads.emplace_back(open_sensor, std::ref(sensors[i]));
+                        open_sensor(sensors[0]);
+                        for (auto&& t : threads)
+                            t.join();
+                        for (auto&& so : sensors)
+                            if (!error)
+                                error = so.error;
+                    }
+                    else
+                    {
+                        for (auto&& so : sensors)
+                        {
+                            open_sensor(so);
+                            if ((error = so.error))
+                                break;
+                        }
                     }
+
+                    if (error)
+                    {
+                        for (auto&& so : sensors)
+                        {
+                            if (!so.opened)
+                                continue;
+                            try
+                            {
+                                so.sensor->close();
+                            }
+                            catch (...)
+                            {
+                            }
+                        }
+                        std::rethrow_exception(error);
+                    }
+
+                    std::map<sensor_interface*, double> durations;
+                    for (auto&& so : sensors)
+                        durations[so.sensor] = so.ms;
+                    return durations;
                 }
 
                 template<class T>
@@ -20,6 +20,8 @@ namespace librealsense
 
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        // Every frame must be measured
+        bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const override { return false; }
 
         enable_auto_exposure_option&    _enable_ae_option;
         rs2_stream                      _stream;
@@ -0,0 +1,132 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "batch-processor.h"
+
+#include <src/core/frame-callback.h>
+
+
+namespace librealsense
+{
+    // Enough to keep every stage busy without holding on to too many frames of the batch at once
+    static const unsigned int STAGE_QUEUE_SIZE = 4;
+
+    batch_processor::batch_processor( std::vector< std::shared_ptr< processing_block > > chain )
+        : _stages( chain.size() )
+    {
+        if( chain.empty() )
+            throw invalid_value_exception( "batch processing requires at least one processing block" );
+
+        for( size_t i = 0; i < chain.size(); ++i )
+        {
+            auto & s = _stages[i];
+            if( ! chain[i] )
+                throw invalid_value_exception( "null processing block in batch" );
+            s.block = chain[i];
+            s.previous_callback = s.block->get_output_callback();
+            s.worker.reset( new dispatcher( STAGE_QUEUE_SIZE ) );
+        }
+
+        // Outputs are collected on the stage thread and forwarded once the invocation returns
+        for( auto & s : _stages )
+        {
+            auto & produced = s.produced;
+            s.block->set_output_callback( make_frame_callback( [&produced]( frame_holder fh )
+                                                               { produced.push_back( std::move( fh ) ); } ) );
+            s.worker->start();
+        }
+    }
+
+    batch_processor::~batch_processor()
+    {
+        for( auto & s : _stages )
+            s.worker->stop();
+        for( auto & s : _stages )
+            s.block->set_output_callback( s.previous_callback );
+    }
+
+    void batch_processor::finish( int work_units )
+    {
+        std::lock_guard< std::mutex > lock( _pending_mutex );
+        _pending -= work_units;
+        if( ! _pending )
+            _pending_done.notify_one();
+    }
+
+    void batch_processor::run_stage( size_t i, size_t index, frame_holder f )
+    {
+        auto & s = _stages[i];
+        s.produced.clear();
+        try
+        {
+            s.block->invoke( std::move( f ) );
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "Batch processing of frame " << index << " failed: " << e.what() );
+            s.produced.clear();
+        }
+
+        if( i + 1 == _stages.size() )
+        {
+            if( ! s.produced.empty() )
+            {
+                // Results are held until the whole batch is done: they mustn't count against the frames the block
+                // may have published at a time, or a batch larger than that would starve its allocator
+                s.produced.back()->keep();
+                _results[index] = std::move( s.produced.back() );
+            }
+            s.produced.clear();
+            finish( 1 );
+            return;
+        }
+
+        // A block may emit more than one frame per input (or none); each is one unit of work downstream
+        auto outputs = std::move( s.produced );
+        s.produced.clear();
+        if( outputs.empty() )
+        {
+            finish( 1 );
+            return;
+        }
+        if( outputs.size() > 1 )
+        {
+            std::lock_guard< std::mutex > lock( _pending_mutex );
+            _pending += int( outputs.size() ) - 1;
+        }
+        for( auto & out : outputs )
+        {
+            auto fh = std::make_shared< frame_holder >( std::move( out ) );
+            _stages[i + 1].worker->invoke( [this, i, index, fh]( dispatcher::cancellable_timer const & )
+                                           { run_stage( i + 1, index, std::move( *fh ) ); },
+                                           true );
+        }
+    }
+
+    std::vector< frame_holder > batch_processor::process( std::vector< frame_holder > frames )
+    {
+        std::lock_guard< std::mutex > lock( _process_mutex );
+
+        _results.clear();
+        _results.resize( frames.size() );
+        {
+            std::lock_guard< std::mutex > pending_lock( _pending_mutex );
+            _pending = int( frames.size() );
+        }
+
+        // The stage queues are bounded, so feeding the batch blocks whenever the pipeline is full
+        for( size_t k = 0; k < frames.size(); ++k )
+        {
+            auto fh = std::make_shared< frame_holder >( std::move( frames[k] ) );
+            _stages.front().worker->invoke( [this, k, fh]( dispatcher::cancellable_timer const & )
+                                            { run_stage( 0, k, std::move( *fh ) ); },
+                                            true );
+        }
+
+        std::unique_lock< std::mutex > pending_lock( _pending_mutex );
+        _pending_done.wait( pending_lock, [this] { return _pending <= 0; } );
+        pending_lock.unlock();
+
+        return std::move( _results );
+    }
+}
@@ -0,0 +1,52 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <rsutils/concurrency/concurrency.h>
+
+#include <condition_variable>
+
+
+namespace librealsense
+{
+    // Pushes a batch of frames through a chain of processing blocks, for offline work such as reprocessing recordings.
+    // Every block of the chain runs on its own thread, so block N works on frame K while block N+1 works on frame K-1.
+    // Each block still sees the frames one at a time and in their original order, so stateful blocks (e.g. the
+    // temporal filter) behave exactly as if the frames were processed one by one.
+    //
+    // While the batch processor exists it owns the output of the blocks; their previous output callbacks are restored
+    // on destruction. The blocks must therefore not be invoked by anyone else in the meantime.
+    //
+    class batch_processor
+    {
+    public:
+        batch_processor( std::vector< std::shared_ptr< processing_block > > chain );
+        ~batch_processor();
+
+        // Returns, for every input frame, the last frame the chain produced from it (empty if the frame was dropped)
+        std::vector< frame_holder > process( std::vector< frame_holder > frames );
+
+    private:
+        struct stage
+        {
+            std::shared_ptr< processing_block > block;
+            rs2_frame_callback_sptr previous_callback;
+            std::unique_ptr< dispatcher > worker;
+            std::vector< frame_holder > produced;  // Output of the current invocation
+        };
+
+        void run_stage( size_t i, size_t index, frame_holder f );
+        void finish( int work_units );
+
+        std::vector< stage > _stages;
+        std::vector< frame_holder > _results;
+
+        std::mutex _process_mutex;
+        std::mutex _pending_mutex;
+        std::condition_variable _pending_done;
+        int _pending = 0;
+    };
+}
@@ -246,6 +246,7 @@ namespace librealsense
         });
 
         register_option(RS2_OPTION_FILTER_MAGNITUDE, decimation_control);
+        register_roi_options();
     }
 
     rs2::frame decimation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -265,7 +266,14 @@ namespace librealsense
 
         if (auto tgt = prepare_target_frame(f, source, tgt_type))
         {
-            if (format == RS2_FORMAT_Z16)
+            roi_window window;
+            if (format == RS2_FORMAT_Z16 && get_roi_window(src.get_width(), src.get_height(), window))
+            {
+                decimate_depth_roi(static_cast<const uint16_t*>(src.get_data()),
+                    static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
+                    src.get_width(), window, this->_patch_size);
+            }
+            else if (format == RS2_FORMAT_Z16)
             {
                 decimate_depth(static_cast<const uint16_t*>(src.get_data()),
                     static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
@@ -375,6 +383,14 @@ namespace librealsense
 
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
+    {
+        decimate_depth(frame_data_in, frame_data_out, width_in, scale,
+            _real_width, _real_height, _padded_width, _padded_height);
+    }
+
+    void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t scale, uint16_t real_width, uint16_t real_height,
+        uint16_t padded_width, uint16_t padded_height)
     {
         // Use median filtering
         std::vector<uint16_t> working_kernel(_kernel_size);
@@ -385,14 +401,14 @@ namespace librealsense
 
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            for (int j = 0; j < real_height; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
                 for (size_t i = 0; i < pixel_raws.size(); i++)
                     pixel_raws[i] = block_start + (width_in*i);
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (size_t i = 0, chunk_offset = 0; i < real_width; i++)
                 {
                     wk_itr = wk_begin;
                     // extract data the kernel to process
@@ -448,7 +464,7 @@ namespace librealsense
                 }
 
                 // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
+                for (int j = real_width; j < padded_width; j++)
                     *frame_data_out++ = 0;
 
                 // Skip N lines to the beginnig of the next processing segment
@@ -457,14 +473,14 @@ namespace librealsense
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (int j = 0; j < real_height; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
                 for (size_t i = 0; i < pixel_raws.size(); i++)
                     pixel_raws[i] = block_start + (width_in*i);
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (size_t i = 0, chunk_offset = 0; i < real_width; i++)
                 {
                     int sum = 0;
                     int counter = 0;
@@ -488,7 +504,7 @@ namespace librealsense
                 }
 
                 // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
+                for (int j = real_width; j < padded_width; j++)
                     *frame_data_out++ = 0;
 
                 // Skip N lines to the beginnig of the next processing segment
@@ -497,13 +513,41 @@ namespace librealsense
         }
 
         // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
+        for (auto v = real_height; v < padded_height; ++v)
         {
-            for (auto u = 0; u < _padded_width; ++u)
+            for (auto u = 0; u < padded_width; ++u)
                 *frame_data_out++ = 0;
         }
     }
 
+    void decimation_filter::decimate_depth_roi(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, const roi_window& window, size_t scale)
+    {
+        // Output pixels are produced only for the kernels that intersect the region of interest
+        const uint16_t out_width = _padded_width;
+        const uint16_t out_height = _padded_height;
+        memset(frame_data_out, 0, out_width * out_height * sizeof(uint16_t));
+
+        size_t x0 = window.x / scale;
+        size_t y0 = window.y / scale;
+        size_t x1 = std::min<size_t>((window.x + window.width + scale - 1) / scale, _real_width);
+        size_t y1 = std::min<size_t>((window.y + window.height + scale - 1) / scale, _real_height);
+        if (x1 <= x0 || y1 <= y0)
+            return;
+
+        // Decimate the region into a dense, unpadded image and scatter it into the padded target
+        const auto roi_width = static_cast<uint16_t>(x1 - x0);
+        const auto roi_height = static_cast<uint16_t>(y1 - y0);
+        _roi_buffer.resize(roi_width * roi_height);
+
+        decimate_depth(frame_data_in + (y0 * scale) * width_in + x0 * scale, _roi_buffer.data(), width_in, scale,
+            roi_width, roi_height, roi_width, roi_height);
+
+        copy_rect(_roi_buffer.data(), roi_width * sizeof(uint16_t),
+            frame_data_out + y0 * out_width + x0, out_width * sizeof(uint16_t),
+            roi_width * sizeof(uint16_t), roi_height);
+    }
+
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
     {
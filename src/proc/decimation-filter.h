@@ -21,6 +21,13 @@ namespace librealsense
         void decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
 
+        void decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t scale, uint16_t real_width, uint16_t real_height,
+            uint16_t padded_width, uint16_t padded_height);
+
+        void decimate_depth_roi(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, const roi_window& window, size_t scale);
+
         void decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -41,6 +48,7 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        std::vector<uint16_t>   _roi_buffer;        // Decimated region of interest
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
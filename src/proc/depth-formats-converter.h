@@ -30,6 +30,8 @@ namespace librealsense
         invi_converter(const char* name, rs2_format target_format) :
             functional_processing_block(name, target_format, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME) {};
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+        // Y16 is unpacked pixel for pixel into the same width
+        bool supports_in_place() const override { return _target_format == RS2_FORMAT_Y16; }
     };
 
     class w10_converter : public functional_processing_block
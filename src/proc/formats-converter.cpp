@@ -5,6 +5,7 @@
 #include "stream.h"
 #include <src/composite-frame.h>
 #include <src/core/frame-callback.h>
+#include <src/tracing.h>
 
 #include <ostream>
 
@@ -248,6 +249,7 @@ void formats_converter::prepare_to_convert( stream_profiles from_profiles )
         // Retrieve source profile from cached map and generate the relevant processing block.
         std::unordered_set< std::shared_ptr< stream_profile_interface > > current_resolved_reqs;
         auto best_pb = factory_of_best_match->generate();
+        best_pb->set_trace_stages( RS2_FRAME_TRACE_STAGE_CONVERSION_START, RS2_FRAME_TRACE_STAGE_CONVERSION_END );
         for( const auto & from_profile : from_profiles_of_best_match )
         {
             auto & mapped_raw_profiles = _target_profiles_to_raw_profiles[to_profile( from_profile.get() )];
@@ -428,6 +430,8 @@ void formats_converter::convert_frame( frame_holder & f )
     if( ! f )
         return;
 
+    LRS_TRACE_SCOPE( "convert frame" );
+
     auto & converters = _raw_profile_to_converters[f->get_stream()];
     for( auto & converter : converters )
     {
@@ -58,11 +58,17 @@ namespace librealsense
         });
 
         register_option(RS2_OPTION_HOLES_FILL, hole_filling_mode);
+        register_roi_options();
     }
 
     rs2::frame hole_filling_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         update_configuration(f);
+
+        roi_window window;
+        if (get_roi_window(int(_width), int(_height), window))
+            return process_roi(source, f, window);
+
         auto tgt = prepare_target_frame(f, source);
 
         // Hole filling pass
@@ -94,11 +100,46 @@ namespace librealsense
 
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the input data to the target
+        if (auto tgt = reuse_input_frame(f, _target_stream_profile, _stride, _current_frm_size_pixels * _bpp))
+            return tgt;
+
+        // Otherwise, allocate and copy the content of the input data to the target
         rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
 
         memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
         return tgt;
     }
 
+    rs2::frame hole_filling_filter::process_roi(const rs2::frame_source& source, const rs2::frame& f, const roi_window& window)
+    {
+        // Only the region of interest is filled, everything else is marked invalid
+        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
+        auto tgt_data = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+        memset(tgt_data, 0, _current_frm_size_pixels * _bpp);
+        if (!window.width || !window.height)
+            return tgt;
+
+        // Fill a compact copy of the region and its halo, so that the neighbourhood
+        // lookups of the filling methods stay within the window
+        auto src_data = static_cast<const uint8_t*>(f.get_data());
+        size_t halo_stride = window.halo_width * _bpp;
+        _roi_buffer.resize(window.halo_height * halo_stride);
+        copy_rect(src_data + window.halo_y * _stride + window.halo_x * _bpp, _stride,
+            _roi_buffer.data(), halo_stride, halo_stride, window.halo_height);
+
+        // The 'around' methods skip the border rows, and need at least one inner row
+        if (window.halo_width > 1 && window.halo_height > 2)
+        {
+            if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+                apply_hole_filling<float>(_roi_buffer.data(), window.halo_width, window.halo_height, halo_stride);
+            else
+                apply_hole_filling<uint16_t>(_roi_buffer.data(), window.halo_width, window.halo_height, halo_stride);
+        }
+
+        auto offset = (window.y - window.halo_y) * halo_stride + (window.x - window.halo_x) * _bpp;
+        copy_rect(_roi_buffer.data() + offset, halo_stride,
+            tgt_data + window.y * _stride + window.x * _bpp, _stride, window.width * _bpp, window.height);
+
+        return tgt;
+    }
 }
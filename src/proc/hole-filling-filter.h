@@ -25,9 +25,16 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+        rs2::frame process_roi(const rs2::frame_source& source, const rs2::frame& f, const roi_window& window);
 
         template<typename T>
         void apply_hole_filling(void * image_data)
+        {
+            apply_hole_filling<T>(image_data, _width, _height, _stride);
+        }
+
+        template<typename T>
+        void apply_hole_filling(void * image_data, size_t width, size_t height, size_t stride)
         {
             bool fp = (std::is_floating_point<T>::value);
             T* data = reinterpret_cast<T*>(image_data);
@@ -36,13 +43,13 @@ namespace librealsense
             switch (_hole_filling_mode)
             {
             case hf_fill_from_left:
-                holes_fill_left(data, _width, _height, _stride);
+                holes_fill_left(data, width, height, stride);
                 break;
             case hf_farest_from_around:
-                holes_fill_farest(data, _width, _height, _stride);
+                holes_fill_farest(data, width, height, stride);
                 break;
             case hf_nearest_from_around:
-                holes_fill_nearest(data, _width, _height, _stride);
+                holes_fill_nearest(data, width, height, stride);
                 break;
             default:
                 throw invalid_value_exception( rsutils::string::from() << "Unsupported hole filling mode: "
@@ -167,6 +174,7 @@ namespace librealsense
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         uint8_t                 _hole_filling_mode;
+        std::vector<uint8_t>    _roi_buffer;                // Region of interest (with halo) being filled
     };
     MAP_EXTENSION(RS2_EXTENSION_HOLE_FILLING_FILTER, librealsense::hole_filling_filter);
 }
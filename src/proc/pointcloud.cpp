@@ -47,6 +47,30 @@ namespace librealsense
         return (float3*)image;
     }
 
+    const float3 * pointcloud::depth_to_points_roi(rs2::points output,
+        const rs2_intrinsics &depth_intrinsics, const rs2::depth_frame& depth_frame, const roi_window& window)
+    {
+        // Vertices outside the region of interest are left at the origin, i.e. invalid
+        auto image = (float*)output.get_vertices();
+        memset(image, 0, depth_intrinsics.width * depth_intrinsics.height * sizeof(float3));
+
+        auto depth_scale = depth_frame.get_units();
+        auto depth = (const uint16_t*)depth_frame.get_data();
+        for (int y = window.y; y < window.y + window.height; ++y)
+        {
+            auto offset = y * depth_intrinsics.width + window.x;
+            float * points = image + offset * 3;
+            const uint16_t * z = depth + offset;
+            for (int x = window.x; x < window.x + window.width; ++x)
+            {
+                const float pixel[] = { (float)x, (float)y };
+                rs2_deproject_pixel_to_point(points, &depth_intrinsics, pixel, depth_scale * *z++);
+                points += 3;
+            }
+        }
+        return (float3*)image;
+    }
+
     float3 transform(const rs2_extrinsics *extrin, const float3 &point) { float3 p = {}; rs2_transform_point_to_point(&p.x, extrin, &point.x); return p; }
     float2 project(const rs2_intrinsics *intrin, const float3 & point) { float2 pixel = {}; rs2_project_point_to_pixel(&pixel.x, intrin, &point.x); return pixel; }
     float2 pixel_to_texcoord(const rs2_intrinsics *intrin, const float2 & pixel) { return{ pixel.x / (intrin->width), pixel.y / (intrin->height) }; }
@@ -249,7 +273,11 @@ namespace librealsense
     {
         auto res = allocate_points(source, depth);
         auto pframe = (librealsense::points*)(res.get());
-        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
+
+        roi_window window;
+        const float3* points = get_roi_window(_depth_intrinsics->width, _depth_intrinsics->height, window)
+            ? depth_to_points_roi(res, *_depth_intrinsics, depth, window)
+            : depth_to_points(res, *_depth_intrinsics, depth);
 
         auto vid_frame = depth.as<rs2::video_frame>();
 
@@ -321,6 +349,24 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Off");
         occlusion_invalidation->set_description(2.f, "On");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+        register_roi_options();
+    }
+
+    bool pointcloud::extend_cache_key(const rs2::frame& f, std::vector<double>& key) const
+    {
+        // A frameset brings its own texture, which is already part of the key
+        if (f.is<rs2::frameset>())
+            return true;
+        // Mapping to a texture must always take effect
+        if (!f.is<rs2::depth_frame>())
+            return false;
+        if (_other_stream)
+        {
+            key.push_back(double(_other_stream.get_profile().unique_id()));
+            key.push_back(double(_other_stream.get_frame_number()));
+            key.push_back(_other_stream.get_timestamp());
+        }
+        return true;
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
@@ -38,6 +38,8 @@ namespace librealsense
 
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        // Adds the texture frame mapped to, if any; textures themselves are not cached
+        bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const override;
 
         optional_value<rs2_intrinsics>         _depth_intrinsics;
         optional_value<rs2_intrinsics>         _other_intrinsics;
@@ -55,6 +57,10 @@ namespace librealsense
         void inspect_depth_frame(const rs2::frame& depth);
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
+        const float3 * depth_to_points_roi(rs2::points output,
+            const rs2_intrinsics &depth_intrinsics,
+            const rs2::depth_frame& depth_frame,
+            const roi_window& window);
         void set_extrinsics();
 
         stream_filter _prev_stream_filter;
@@ -0,0 +1,380 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "processing-graph.h"
+
+#include "align.h"
+#include "colorizer.h"
+#include "pointcloud.h"
+#include "units-transform.h"
+#include "rvl-codec.h"
+#include "rscore-pp-block-factory.h"
+
+#include <src/composite-frame.h>
+#include <src/core/stream-profile-interface.h>
+#include <src/core/frame-callback.h>
+#include <src/core/enum-helpers.h>
+
+#include <rsutils/string/from.h>
+#include <rsutils/string/nocase.h>
+#include <rsutils/json.h>
+#include <rsutils/deferred.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
+
+namespace librealsense
+{
+    static bool try_parse_stream( std::string const & name, rs2_stream & stream )
+    {
+        for( int i = RS2_STREAM_ANY; i < RS2_STREAM_COUNT; ++i )
+        {
+            if( rsutils::string::nocase_equal( name, get_string( rs2_stream( i ) ) ) )
+            {
+                stream = rs2_stream( i );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static std::vector< std::string > get_string_list( rsutils::json const & j, char const * what )
+    {
+        std::vector< std::string > list;
+        if( j.is_string() )
+            list.push_back( j.get< std::string >() );
+        else if( j.is_array() )
+        {
+            for( auto & item : j )
+            {
+                if( ! item.is_string() )
+                    throw invalid_value_exception( rsutils::string::from() << "processing graph " << what
+                                                                           << " must be strings" );
+                list.push_back( item.get< std::string >() );
+            }
+        }
+        else if( ! j.is_null() )
+            throw invalid_value_exception( rsutils::string::from() << "processing graph " << what
+                                                                   << " must be a string or an array of strings" );
+        return list;
+    }
+
+    // Framesets are expanded into their frames: a frameset is made of single frames only
+    static void append_frames( std::vector< frame_holder > & frames, frame_holder && f )
+    {
+        if( auto composite = dynamic_cast< composite_frame * >( f.frame ) )
+        {
+            for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+                frames.push_back( frame_holder::acquire( composite->get_frame( int( i ) ) ) );
+        }
+        else
+            frames.push_back( std::move( f ) );
+    }
+
+    typedef std::function< std::shared_ptr< processing_block_interface >( rsutils::json const & settings ) >
+        block_factory;
+
+    // Blocks that are not recorded into rosbags, and are therefore unknown to the pp-block factory
+    static std::map< std::string, block_factory, rsutils::string::nocase_less_t > const graph_blocks = {
+        { "align",
+          []( rsutils::json const & settings ) -> std::shared_ptr< processing_block_interface >
+          {
+              rs2_stream to = RS2_STREAM_COLOR;
+              auto it = settings.find( "to" );
+              if( it != settings.end() && ( ! it->is_string() || ! try_parse_stream( it->get< std::string >(), to ) ) )
+                  throw invalid_value_exception( rsutils::string::from() << "invalid align target " << *it );
+              return align::create_align( to );
+          } },
+        { "pointcloud", []( rsutils::json const & ) { return pointcloud::create(); } },
+        { "colorizer", []( rsutils::json const & ) { return std::make_shared< colorizer >(); } },
+        { "Units Transform", []( rsutils::json const & ) { return std::make_shared< units_transform >(); } },
+        { "RVL Encoder", []( rsutils::json const & ) { return std::make_shared< rvl_encoder >(); } },
+        { "RVL Decoder", []( rsutils::json const & ) { return std::make_shared< rvl_decoder >(); } },
+    };
+
+    std::shared_ptr< processing_block_interface >
+    processing_graph::create_block( std::string const & name, rsutils::json const & settings )
+    {
+        auto it = graph_blocks.find( name );
+        if( it != graph_blocks.end() )
+            return it->second( settings );
+        return rscore_pp_block_factory().create_pp_block( name, settings );
+    }
+
+    processing_graph::processing_graph( rsutils::json const & description )
+        : processing_block( "Processing Graph" )
+    {
+        if( ! description.is_object() )
+            throw invalid_value_exception( "processing graph description must be a JSON object" );
+
+        auto nodes = description.find( "nodes" );
+        if( nodes == description.end() || ! nodes->is_array() || nodes->empty() )
+            throw invalid_value_exception( "processing graph requires a non-empty 'nodes' array" );
+
+        std::map< std::string, int > by_name;
+        for( auto & j : *nodes )
+        {
+            node n;
+            auto name = j.find( "name" );
+            auto block = j.find( "block" );
+            if( name == j.end() || ! name->is_string() || block == j.end() || ! block->is_string() )
+                throw invalid_value_exception( rsutils::string::from() << "processing graph node " << j
+                                                                       << " requires a 'name' and a 'block'" );
+            n.name = name->get< std::string >();
+            if( ! by_name.emplace( n.name, int( _nodes.size() ) ).second )
+                throw invalid_value_exception( rsutils::string::from() << "duplicate processing graph node '"
+                                                                       << n.name << "'" );
+
+            auto settings = j.find( "settings" );
+            n.block = create_block( block->get< std::string >(),
+                                    settings == j.end() ? rsutils::json::object() : *settings );
+            if( ! n.block )
+                throw invalid_value_exception( rsutils::string::from() << "unknown processing block '"
+                                                                       << block->get< std::string >() << "'" );
+
+            auto options = j.find( "options" );
+            if( options != j.end() )
+            {
+                for( auto it = options->begin(); it != options->end(); ++it )
+                {
+                    rs2_option opt;
+                    if( ! try_parse( it.key(), opt ) || ! it.value().is_number() )
+                        throw invalid_value_exception( rsutils::string::from() << "invalid option '" << it.key()
+                                                                               << "' for node '" << n.name << "'" );
+                    n.block->get_option( opt ).set( it.value().get< float >() );
+                }
+            }
+
+            auto inputs = j.find( "inputs" );
+            if( inputs == j.end() )
+                throw invalid_value_exception( rsutils::string::from() << "processing graph node '" << n.name
+                                                                       << "' has no inputs" );
+            n.inputs = get_string_list( *inputs, "inputs" );
+            if( n.inputs.empty() )
+                throw invalid_value_exception( rsutils::string::from() << "processing graph node '" << n.name
+                                                                       << "' has no inputs" );
+            _nodes.push_back( std::move( n ) );
+        }
+
+        // Inputs may reference nodes declared later, so these are resolved only once all nodes are known
+        for( auto & n : _nodes )
+        {
+            for( auto & input : n.inputs )
+            {
+                auto it = by_name.find( input );
+                rs2_stream stream = RS2_STREAM_ANY;
+                if( it != by_name.end() )
+                {
+                    n.input_nodes.push_back( it->second );
+                    ++_nodes[it->second].consumers;
+                }
+                else if( try_parse_stream( input, stream ) )
+                    n.input_nodes.push_back( -1 );
+                else
+                    throw invalid_value_exception( rsutils::string::from() << "unknown input '" << input
+                                                                           << "' for node '" << n.name << "'" );
+                n.input_streams.push_back( stream );
+            }
+
+            auto & output = n.output;
+            n.block->set_output_callback( make_frame_callback( [&output]( frame_holder fh )
+                                                               { output = std::move( fh ); } ) );
+        }
+
+        auto outputs = description.find( "outputs" );
+        if( outputs == description.end() )
+            throw invalid_value_exception( "processing graph requires 'outputs'" );
+        for( auto & name : get_string_list( *outputs, "outputs" ) )
+        {
+            auto it = by_name.find( name );
+            if( it == by_name.end() )
+                throw invalid_value_exception( rsutils::string::from() << "unknown processing graph output '"
+                                                                       << name << "'" );
+            _outputs.push_back( it->second );
+            ++_nodes[it->second].consumers;
+        }
+        if( _outputs.empty() )
+            throw invalid_value_exception( "processing graph requires at least one output" );
+
+        resolve_levels();
+
+        size_t width = 0;
+        for( auto & level : _levels )
+            width = std::max( width, level.size() );
+        // The invoking thread runs one node of each level itself
+        for( size_t i = 1; i < width; ++i )
+        {
+            _workers.emplace_back( new dispatcher( 1 ) );
+            _workers.back()->start();
+        }
+    }
+
+    processing_graph::~processing_graph()
+    {
+        for( auto & worker : _workers )
+            worker->stop();
+        _source.flush();
+    }
+
+    // Kahn's algorithm, grouping the nodes by dependency depth so that the nodes of a level are independent
+    void processing_graph::resolve_levels()
+    {
+        std::vector< int > in_degree( _nodes.size(), 0 );
+        std::vector< std::vector< int > > dependents( _nodes.size() );
+        for( int i = 0; i < int( _nodes.size() ); ++i )
+        {
+            for( auto dep : _nodes[i].input_nodes )
+            {
+                if( dep < 0 )
+                    continue;
+                ++in_degree[i];
+                dependents[dep].push_back( i );
+            }
+        }
+
+        std::vector< int > level;
+        for( int i = 0; i < int( _nodes.size() ); ++i )
+            if( ! in_degree[i] )
+                level.push_back( i );
+
+        size_t resolved = 0;
+        while( ! level.empty() )
+        {
+            std::vector< int > next;
+            for( auto i : level )
+                for( auto d : dependents[i] )
+                    if( ! --in_degree[d] )
+                        next.push_back( d );
+            resolved += level.size();
+            _levels.push_back( std::move( level ) );
+            level = std::move( next );
+        }
+
+        if( resolved != _nodes.size() )
+        {
+            rsutils::string::from cycle;
+            cycle << "processing graph contains a cycle through";
+            for( int i = 0; i < int( _nodes.size() ); ++i )
+                if( in_degree[i] )
+                    cycle << " '" << _nodes[i].name << "'";
+            throw invalid_value_exception( cycle );
+        }
+    }
+
+    void processing_graph::run_node( node & n, frame_holder const & frames )
+    {
+        // Nodes run on the workers too, where nothing may escape
+        try
+        {
+            invoke_node( n, frames );
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "Processing graph node '" << n.name << "' failed: " << e.what() );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Processing graph node '" << n.name << "' failed" );
+        }
+    }
+
+    void processing_graph::invoke_node( node & n, frame_holder const & frames )
+    {
+        std::vector< frame_holder > inputs;
+        for( size_t i = 0; i < n.input_nodes.size(); ++i )
+        {
+            frame_interface * f = nullptr;
+            if( n.input_nodes[i] >= 0 )
+                f = _nodes[n.input_nodes[i]].output;
+            else if( auto composite = dynamic_cast< composite_frame * >( frames.frame ) )
+            {
+                for( size_t j = 0; ! f && j < composite->get_embedded_frames_count(); ++j )
+                {
+                    auto sub = composite->get_frame( int( j ) );
+                    if( sub->get_stream()->get_stream_type() == n.input_streams[i] )
+                        f = sub;
+                }
+            }
+            else if( frames->get_stream()->get_stream_type() == n.input_streams[i] )
+                f = frames;
+
+            if( ! f )
+                return;  // Not everything this node needs is present for the current frame
+            // An output with a single consumer is handed over, which lets the consumer process it in place
+            if( n.input_nodes[i] >= 0 && _nodes[n.input_nodes[i]].consumers == 1 )
+                inputs.push_back( std::move( _nodes[n.input_nodes[i]].output ) );
+            else
+                inputs.push_back( frame_holder::acquire( f ) );
+        }
+        if( inputs.size() > 1 )
+        {
+            std::vector< frame_holder > frames;
+            for( auto & f : inputs )
+                append_frames( frames, std::move( f ) );
+            inputs = std::move( frames );
+        }
+
+        frame_holder input = inputs.size() == 1
+                               ? std::move( inputs.front() )
+                               : frame_holder( _source_wrapper.allocate_composite_frame( std::move( inputs ) ) );
+        if( ! input )
+        {
+            LOG_ERROR( "Processing graph node '" << n.name << "' skipped: failed to allocate its input frameset" );
+            return;
+        }
+        n.block->invoke( std::move( input ) );
+    }
+
+    void processing_graph::run_level( std::vector< int > const & level, frame_holder const & frames )
+    {
+        {
+            std::lock_guard< std::mutex > lock( _level_mutex );
+            _pending = level.size() - 1;
+        }
+        for( size_t i = 1; i < level.size(); ++i )
+        {
+            node & n = _nodes[level[i]];
+            _workers[i - 1]->invoke(
+                [this, &n, &frames]( dispatcher::cancellable_timer const & )
+                {
+                    // The level waits for every node, whatever happens to it
+                    rsutils::deferred done( [this]
+                                            {
+                                                std::lock_guard< std::mutex > lock( _level_mutex );
+                                                if( ! --_pending )
+                                                    _level_done.notify_one();
+                                            } );
+                    run_node( n, frames );
+                },
+                true );
+        }
+
+        run_node( _nodes[level.front()], frames );
+
+        std::unique_lock< std::mutex > lock( _level_mutex );
+        _level_done.wait( lock, [this] { return ! _pending; } );
+    }
+
+    void processing_graph::invoke( frame_holder frames )
+    {
+        std::lock_guard< std::mutex > lock( _invoke_mutex );
+
+        for( auto & level : _levels )
+            run_level( level, frames );
+
+        std::vector< frame_holder > results;
+        for( auto i : _outputs )
+            if( _nodes[i].output )
+                append_frames( results, _nodes[i].output.clone() );
+        for( auto & n : _nodes )
+            n.output.reset();
+
+        if( results.empty() )
+            return;
+        frame_holder result( _source_wrapper.allocate_composite_frame( std::move( results ) ) );
+        if( result )
+            _source_wrapper.frame_ready( std::move( result ) );
+    }
+}
@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <rsutils/json-fwd.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <condition_variable>
+
+
+namespace librealsense
+{
+    // A directed acyclic graph of processing blocks. Unlike composite_processing_block, which is a linear chain,
+    // nodes that do not depend on each other (e.g. align and pointcloud, or color conversion and depth filtering)
+    // run concurrently. The graph is described in JSON:
+    //
+    //     {
+    //         "nodes": [
+    //             { "name": "aligned",  "block": "align", "settings": { "to": "color" }, "inputs": [ "depth", "color" ] },
+    //             { "name": "filtered", "block": "Spatial Filter", "inputs": [ "depth" ], "options": { "Filter Magnitude": 3 } },
+    //             { "name": "cloud",    "block": "pointcloud", "inputs": [ "filtered" ] }
+    //         ],
+    //         "outputs": [ "aligned", "cloud" ]
+    //     }
+    //
+    // An input names either another node, whose output it consumes, or a stream type ("depth", "color", ...) which is
+    // picked from the incoming frameset. A node with several inputs receives them as one frameset; a node whose
+    // inputs are not all available for a given frame is skipped. The outputs are combined into a single frameset.
+    //
+    class processing_graph : public processing_block
+    {
+    public:
+        processing_graph( rsutils::json const & description );
+        ~processing_graph();
+
+        void invoke( frame_holder frames ) override;
+
+    private:
+        struct node
+        {
+            std::string name;
+            std::shared_ptr< processing_block_interface > block;
+            std::vector< std::string > inputs;
+            std::vector< int > input_nodes;         // Index into _nodes, or -1 for a stream input
+            std::vector< rs2_stream > input_streams;
+            int consumers = 0;                      // Downstream nodes and graph outputs using this node's output
+            frame_holder output;
+        };
+
+        static std::shared_ptr< processing_block_interface > create_block( std::string const & name,
+                                                                           rsutils::json const & settings );
+        void resolve_levels();
+        // Runs a node, logging any failure
+        void run_node( node & n, frame_holder const & frames );
+        void invoke_node( node & n, frame_holder const & frames );
+        void run_level( std::vector< int > const & level, frame_holder const & frames );
+
+        std::vector< node > _nodes;
+        std::vector< std::vector< int > > _levels;  // Nodes grouped by dependency depth; each level runs in parallel
+        std::vector< int > _outputs;
+
+        std::vector< std::unique_ptr< dispatcher > > _workers;
+        std::mutex _invoke_mutex;
+        std::mutex _level_mutex;
+        std::condition_variable _level_done;
+        size_t _pending = 0;
+    };
+}
@@ -16,6 +16,8 @@ namespace librealsense
 
     protected:
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        // Every frame must be counted
+        bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const override { return false; }
         bool should_process(const rs2::frame& frame) override;
     private:
         class profile
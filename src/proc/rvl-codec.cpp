@@ -0,0 +1,249 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include <src/core/video-frame.h>
+#include "proc/synthetic-stream.h"
+#include "rvl-codec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace librealsense
+{
+    namespace rvl
+    {
+        namespace
+        {
+            class nibble_writer
+            {
+            public:
+                explicit nibble_writer( uint8_t * out ) : _begin( out ), _out( out ), _byte( 0 ), _half( false ) {}
+
+                void write( uint32_t value )
+                {
+                    do
+                    {
+                        uint8_t nibble = value & 0x7;
+                        value >>= 3;
+                        if( value )
+                            nibble |= 0x8;
+                        if( _half )
+                            *_out++ = uint8_t( _byte | nibble );
+                        else
+                            _byte = uint8_t( nibble << 4 );
+                        _half = ! _half;
+                    }
+                    while( value );
+                }
+
+                // Bytes written so far, including any that is half full
+                size_t size() const { return _out - _begin + ( _half ? 1 : 0 ); }
+
+                size_t finish()
+                {
+                    if( _half )
+                    {
+                        *_out++ = _byte;
+                        _half = false;
+                    }
+                    return _out - _begin;
+                }
+
+            private:
+                uint8_t * const _begin;
+                uint8_t * _out;
+                uint8_t _byte;
+                bool _half;
+            };
+
+            class nibble_reader
+            {
+            public:
+                nibble_reader( uint8_t const * data, size_t size ) : _in( data ), _end( data + size ), _half( false ) {}
+
+                uint32_t read()
+                {
+                    uint32_t value = 0;
+                    int shift = 0;
+                    uint8_t nibble;
+                    do
+                    {
+                        if( _in == _end )
+                            throw invalid_value_exception( "RVL data is truncated" );
+                        if( _half )
+                            nibble = *_in++ & 0xf;
+                        else
+                            nibble = *_in >> 4;
+                        _half = ! _half;
+                        if( shift > 30 )
+                            throw invalid_value_exception( "RVL data is corrupt" );
+                        value |= uint32_t( nibble & 0x7 ) << shift;
+                        shift += 3;
+                    }
+                    while( nibble & 0x8 );
+                    return value;
+                }
+
+                // Everything was read, except maybe the padding nibble
+                bool done() const { return _in == _end || ( _half && _in + 1 == _end && ! ( *_in & 0xf ) ); }
+
+            private:
+                uint8_t const * _in;
+                uint8_t const * const _end;
+                bool _half;
+            };
+        }
+
+        size_t max_encoded_size( size_t pixels )
+        {
+            // Each run takes no more nibbles than it has pixels, plus 6 per non-zero pixel (17-bit deltas)
+            return 4 * pixels + 16;
+        }
+
+        size_t encode( uint16_t const * depth, size_t pixels, uint8_t * out, size_t capacity )
+        {
+            nibble_writer writer( out );
+            uint16_t const * const end = depth + pixels;
+            int32_t previous = 0;
+            while( depth != end )
+            {
+                auto const zeros = depth;
+                while( depth != end && ! *depth )
+                    ++depth;
+                auto nonzeros_end = depth;
+                while( nonzeros_end != end && *nonzeros_end )
+                    ++nonzeros_end;
+
+                // Two run lengths of up to 11 nibbles, and the deltas
+                if( capacity - writer.size() < 12 + 3 * size_t( nonzeros_end - depth ) )
+                    return 0;
+
+                writer.write( uint32_t( depth - zeros ) );
+                writer.write( uint32_t( nonzeros_end - depth ) );
+                for( ; depth != nonzeros_end; ++depth )
+                {
+                    int32_t const delta = int32_t( *depth ) - previous;
+                    previous = *depth;
+                    writer.write( ( uint32_t( delta ) << 1 ) ^ uint32_t( delta >> 31 ) );  // zigzag
+                }
+            }
+            return writer.finish();
+        }
+
+        uint16_t const * pack( void const * image, int width, int height, int stride, std::vector< uint16_t > & buffer )
+        {
+            auto const row_size = width * sizeof( uint16_t );
+            if( stride == int( row_size ) )
+                return static_cast< uint16_t const * >( image );
+            buffer.resize( size_t( width ) * height );
+            for( int y = 0; y < height; ++y )
+                memcpy( buffer.data() + size_t( y ) * width,
+                        static_cast< uint8_t const * >( image ) + size_t( y ) * stride,
+                        row_size );
+            return buffer.data();
+        }
+
+        void decode( uint8_t const * data, size_t size, uint16_t * depth, size_t pixels )
+        {
+            nibble_reader reader( data, size );
+            uint16_t * const end = depth + pixels;
+            int32_t previous = 0;
+            while( depth != end )
+            {
+                auto const zeros = reader.read();
+                if( zeros > size_t( end - depth ) )
+                    throw invalid_value_exception( "RVL data has too many pixels" );
+                std::fill_n( depth, zeros, uint16_t( 0 ) );
+                depth += zeros;
+
+                auto const nonzeros = reader.read();
+                if( nonzeros > size_t( end - depth ) )
+                    throw invalid_value_exception( "RVL data has too many pixels" );
+                for( uint32_t i = 0; i < nonzeros; ++i )
+                {
+                    auto const zigzag = reader.read();
+                    previous += int32_t( zigzag >> 1 ) ^ -int32_t( zigzag & 1 );
+                    *depth++ = uint16_t( previous );
+                }
+            }
+            if( ! reader.done() )
+                throw invalid_value_exception( "RVL data has too many pixels" );
+        }
+    }
+
+    rvl_encoder::rvl_encoder() : stream_filter_processing_block("RVL Encoder")
+    {
+        _stream_filter.format = RS2_FORMAT_Z16;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame rvl_encoder::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        if (f.get_profile().get() != _source_stream_profile.get())
+        {
+            _source_stream_profile = f.get_profile();
+            _target_stream_profile = f.get_profile().clone(f.get_profile().stream_type(), f.get_profile().stream_index(), RS2_FORMAT_Z16RVL);
+        }
+
+        auto vf = f.as<rs2::video_frame>();
+        auto width = vf.get_width();
+        auto height = vf.get_height();
+        // Starts out the size of the raw image, which most depth encodes to well within
+        auto new_f = source.allocate_video_frame(_target_stream_profile, f,
+            sizeof(uint16_t), width, height, width * sizeof(uint16_t), RS2_EXTENSION_VIDEO_FRAME);
+        if (!new_f)
+            return f;
+
+        auto ptr = dynamic_cast<librealsense::video_frame*>((librealsense::frame_interface*)new_f.get());
+        auto orig = dynamic_cast<librealsense::video_frame*>((librealsense::frame_interface*)f.get());
+        if (!ptr || !orig)
+            throw std::runtime_error("Frame is not video frame");
+        ptr->set_sensor(orig->get_sensor());
+
+        auto depth = rvl::pack(orig->get_frame_data(), width, height, vf.get_stride_in_bytes(), _packed);
+        size_t const pixels = size_t(width) * height;
+
+        auto size = rvl::encode(depth, pixels, ptr->data.data(), ptr->data.size());
+        if (!size)
+        {
+            ptr->data.resize(rvl::max_encoded_size(pixels));
+            size = rvl::encode(depth, pixels, ptr->data.data(), ptr->data.size());
+        }
+        ptr->data.resize(size);
+        return new_f;
+    }
+
+    rvl_decoder::rvl_decoder() : stream_filter_processing_block("RVL Decoder")
+    {
+        _stream_filter.format = RS2_FORMAT_Z16RVL;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame rvl_decoder::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        if (f.get_profile().get() != _source_stream_profile.get())
+        {
+            _source_stream_profile = f.get_profile();
+            _target_stream_profile = f.get_profile().clone(f.get_profile().stream_type(), f.get_profile().stream_index(), RS2_FORMAT_Z16);
+        }
+
+        auto vf = f.as<rs2::video_frame>();
+        auto width = vf.get_width();
+        auto height = vf.get_height();
+        auto new_f = source.allocate_video_frame(_target_stream_profile, f,
+            sizeof(uint16_t), width, height, width * sizeof(uint16_t), RS2_EXTENSION_DEPTH_FRAME);
+        if (!new_f)
+            return f;
+
+        auto ptr = reinterpret_cast<librealsense::frame_interface*>(new_f.get());
+        auto orig = reinterpret_cast<librealsense::frame_interface*>(f.get());
+        ptr->set_sensor(orig->get_sensor());
+
+        rvl::decode(orig->get_frame_data(), orig->get_frame_data_size(),
+            (uint16_t*)ptr->get_frame_data(), size_t(width) * height);
+        return new_f;
+    }
+}
@@ -0,0 +1,69 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rs2
+{
+    class stream_profile;
+}
+
+namespace librealsense
+{
+    /*
+        Lossless RVL coding of 16-bit depth (A. Wilson, "Fast Lossless Depth Image Compression", 2017):
+        the image is split into alternating runs of zero (invalid) and non-zero pixels; each run length, and the delta
+        of each non-zero pixel from the previous non-zero one, is written as a variable-length code of 3-bit nibbles.
+        Nibbles are packed two per byte, most significant first, so the encoding does not depend on endianness.
+    */
+    namespace rvl
+    {
+        // Upper bound on the size of an encoding of the given number of pixels
+        size_t max_encoded_size( size_t pixels );
+
+        // Encodes densely packed pixels; returns the encoded size, or 0 if it would not fit in the given capacity
+        size_t encode( uint16_t const * depth, size_t pixels, uint8_t * out, size_t capacity );
+
+        // Returns the pixels of an image with the given stride in bytes densely packed: the image itself if its rows
+        // are not padded, otherwise a copy in buffer
+        uint16_t const * pack( void const * image, int width, int height, int stride, std::vector< uint16_t > & buffer );
+
+        // Decodes into densely packed pixels; throws if the data does not hold exactly that many pixels
+        void decode( uint8_t const * data, size_t size, uint16_t * depth, size_t pixels );
+    }
+
+    // Encodes Z16 depth frames to Z16RVL
+    class rvl_encoder : public stream_filter_processing_block
+    {
+    public:
+        rvl_encoder();
+
+    protected:
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        rs2::stream_profile _target_stream_profile;
+        rs2::stream_profile _source_stream_profile;
+        std::vector< uint16_t > _packed;  // for frames whose rows are padded
+    };
+
+    // Decodes Z16RVL frames back to Z16 depth frames
+    class rvl_decoder : public stream_filter_processing_block
+    {
+    public:
+        rvl_decoder();
+
+    protected:
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        rs2::stream_profile _target_stream_profile;
+        rs2::stream_profile _source_stream_profile;
+    };
+}
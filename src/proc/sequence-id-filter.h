@@ -17,6 +17,8 @@ namespace librealsense
     protected:
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        // The result depends on the earlier frames of each sequence
+        bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const override { return false; }
 
     private:
         bool is_selected_id(int stream_index) const;
@@ -157,6 +157,7 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+        register_roi_options();
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -164,13 +165,52 @@ namespace librealsense
         rs2::frame tgt;
 
         update_configuration(f);
+
+        roi_window window;
+        if (get_roi_window(int(_width), int(_height), window))
+            return process_roi(source, f, window);
+
         tgt = prepare_target_frame(f, source);
 
         // Spatial domain transform edge-preserving filter
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            dxf_smooth<float>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            dxf_smooth<float>(const_cast<void*>(tgt.get_data()), _width, _height, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
         else
-            dxf_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            dxf_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _width, _height, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+
+        return tgt;
+    }
+
+    rs2::frame spatial_filter::process_roi(const rs2::frame_source& source, const rs2::frame& f, const roi_window& window)
+    {
+        // Only the region of interest is filtered, everything else is marked invalid
+        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
+        auto tgt_data = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+        memset(tgt_data, 0, _current_frm_size_pixels * _bpp);
+        if (!window.width || !window.height)
+            return tgt;
+
+        // The filter runs on a compact copy of the region and its halo
+        auto src_data = static_cast<const uint8_t*>(f.get_data());
+        auto halo_stride = window.halo_width * _bpp;
+        _roi_buffer.resize(window.halo_height * halo_stride);
+        copy_rect(src_data + window.halo_y * _stride + window.halo_x * _bpp, _stride,
+            _roi_buffer.data(), halo_stride, halo_stride, window.halo_height);
+
+        // The recursive passes need at least two pixels along each axis
+        if (window.halo_width > 1 && window.halo_height > 1)
+        {
+            if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+                dxf_smooth<float>(_roi_buffer.data(), window.halo_width, window.halo_height,
+                    _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            else
+                dxf_smooth<uint16_t>(_roi_buffer.data(), window.halo_width, window.halo_height,
+                    _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+        }
+
+        auto offset = (window.y - window.halo_y) * halo_stride + (window.x - window.halo_x) * _bpp;
+        copy_rect(_roi_buffer.data() + offset, halo_stride,
+            tgt_data + window.y * _stride + window.x * _bpp, _stride, window.width * _bpp, window.height);
 
         return tgt;
     }
@@ -231,28 +271,31 @@ namespace librealsense
 
     rs2::frame spatial_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the original Depth data to the target
+        if (auto tgt = reuse_input_frame(f, _target_stream_profile, _stride, _current_frm_size_pixels * _bpp))
+            return tgt;
+
+        // Otherwise, allocate and copy the content of the original Depth data to the target
         rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
 
         memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
         return tgt;
     }
 
-    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, size_t width, size_t height, float alpha, float deltaZ)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
         int v, u;
 
-        for (v = 0; v < _height;) {
+        for (v = 0; v < height;) {
             // left to right
-            float *im = image + v * _width;
+            float *im = image + v * width;
             float state = *im;
             float previousInnovation = state;
 
             im++;
             float innovation = *im;
-            u = int(_width) - 1;
+            u = int(width) - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidLR;
             // else fall through
@@ -307,9 +350,9 @@ namespace librealsense
         DoneLR:
 
             // right to left
-            im = image + (v + 1) * _width - 2;  // end of row - two pixels
+            im = image + (v + 1) * width - 2;  // end of row - two pixels
             previousInnovation = state = im[1];
-            u = int(_width) - 1;
+            u = int(width) - 1;
             innovation = *im;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidRL;
@@ -366,7 +409,7 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, size_t width, size_t height, float alpha, float deltaZ)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
@@ -374,14 +417,14 @@ namespace librealsense
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = 0; u < width;) {
 
             float *im = image + u;
             float state = im[0];
             float previousInnovation = state;
 
-            v = int(_height) - 1;
-            im += _width;
+            v = int(height) - 1;
+            im += width;
             float innovation = *im;
 
             if (!(*(int*)&previousInnovation > 0))
@@ -405,7 +448,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -413,7 +456,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyInvalidTB;
                 }
@@ -426,22 +469,22 @@ namespace librealsense
                     goto DoneTB;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyValidTB;
                 }
                 else {
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
             }
         DoneTB:
 
-            im = image + u + (_height - 2) * _width;
-            state = im[_width];
+            im = image + u + (height - 2) * width;
+            state = im[width];
             previousInnovation = state;
             innovation = *im;
-            v = int(_height) - 1;
+            v = int(height) - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidBT;
             // else fall through
@@ -462,7 +505,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -470,7 +513,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyInvalidBT;
                 }
@@ -483,12 +526,12 @@ namespace librealsense
                     goto DoneBT;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyValidBT;
                 }
                 else {
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
             }
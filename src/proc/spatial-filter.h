@@ -25,9 +25,10 @@ namespace librealsense
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        rs2::frame process_roi(const rs2::frame_source& source, const rs2::frame& f, const roi_window& window);
 
         template <typename T>
-        void dxf_smooth(void *frame_data, float alpha, float delta, int iterations)
+        void dxf_smooth(void *frame_data, size_t width, size_t height, float alpha, float delta, int iterations)
         {
             static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
             const bool fp = (std::is_floating_point<T>::value);
@@ -36,27 +37,27 @@ namespace librealsense
             {
                 if (fp)
                 {
-                    recursive_filter_horizontal_fp(frame_data, alpha, delta);
-                    recursive_filter_vertical_fp(frame_data, alpha, delta);
+                    recursive_filter_horizontal_fp(frame_data, width, height, alpha, delta);
+                    recursive_filter_vertical_fp(frame_data, width, height, alpha, delta);
                 }
                 else
                 {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    recursive_filter_horizontal<T>(frame_data, width, height, alpha, delta);
+                    recursive_filter_vertical<T>(frame_data, width, height, alpha, delta);
                 }
             }
 
             // Disparity domain hole filling requires a second pass over the frame data
             // For depth domain a more efficient in-place hole filling is performed
             if (_holes_filling_mode && fp)
-                intertial_holes_fill<T>(static_cast<T*>(frame_data));
+                intertial_holes_fill<T>(static_cast<T*>(frame_data), width, height);
         }
 
-        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
-        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
+        void recursive_filter_horizontal_fp(void * image_data, size_t width, size_t height, float alpha, float deltaZ);
+        void recursive_filter_vertical_fp(void * image_data, size_t width, size_t height, float alpha, float deltaZ);
 
         template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        void  recursive_filter_horizontal(void * image_data, size_t width, size_t height, float alpha, float deltaZ)
         {
             size_t v{}, u{};
 
@@ -72,14 +73,14 @@ namespace librealsense
             auto image = reinterpret_cast<T*>(image_data);
             size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (v = 0; v < height; v++)
             {
                 // left to right
-                T *im = image + v * _width;
+                T *im = image + v * width;
                 T val0 = im[0];
                 cur_fill = 0;
 
-                for (u = 1; u < _width - 1; u++)
+                for (u = 1; u < width - 1; u++)
                 {
                     T val1 = im[1];
 
@@ -112,11 +113,11 @@ namespace librealsense
                 }
 
                 // right to left
-                im = image + (v + 1) * _width - 2;  // end of row - two pixels
+                im = image + (v + 1) * width - 2;  // end of row - two pixels
                 T val1 = im[1];
                 cur_fill = 0;
 
-                for (u = _width - 1; u > 0; u--)
+                for (u = width - 1; u > 0; u--)
                 {
                     T val0 = im[0];
 
@@ -151,7 +152,7 @@ namespace librealsense
         }
 
         template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+        void recursive_filter_vertical(void * image_data, size_t width, size_t height, float alpha, float deltaZ)
         {
             size_t v{}, u{};
 
@@ -173,12 +174,12 @@ namespace librealsense
             T *im = image;
             T im0{};
             T imw{};
-            for (v = 1; v < _height; v++)
+            for (v = 1; v < height; v++)
             {
-                for (u = 0; u < _width; u++)
+                for (u = 0; u < width; u++)
                 {
                     im0 = im[0];
-                    imw = im[_width];
+                    imw = im[width];
 
                     //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
                     {
@@ -186,7 +187,7 @@ namespace librealsense
                         if (diff < delta_z)
                         {
                             float filtered = imw * alpha + im0 * (1.f - alpha);
-                            im[_width] = static_cast<T>(filtered + round);
+                            im[width] = static_cast<T>(filtered + round);
                         }
                     }
                     im += 1;
@@ -194,13 +195,13 @@ namespace librealsense
             }
 
             // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+            im = image + (height - 2) * width;
+            for (v = 1; v < height; v++, im -= (width * 2))
             {
-                for (u = 0; u < _width; u++)
+                for (u = 0; u < width; u++)
                 {
                     im0 = im[0];
-                    imw = im[_width];
+                    imw = im[width];
 
                     if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
                     {
@@ -217,7 +218,7 @@ namespace librealsense
         }
 
         template<typename T>
-        inline void intertial_holes_fill(T* image_data)
+        inline void intertial_holes_fill(T* image_data, size_t width, size_t height)
         {
             std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
@@ -226,13 +227,13 @@ namespace librealsense
             size_t cur_fill = 0;
 
             T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            for (int j = 0; j < height; ++j)
             {
                 ++p;
                 cur_fill = 0;
 
                 //Left to Right
-                for (size_t i = 1; i < _width; ++i)
+                for (size_t i = 1; i < width; ++i)
                 {
                     if (empty(p))
                     {
@@ -248,7 +249,7 @@ namespace librealsense
                 --p;
                 cur_fill = 0;
                 //Right to left
-                for (size_t i = 1; i < _width; ++i)
+                for (size_t i = 1; i < width; ++i)
                 {
                     if (empty(p))
                     {
@@ -259,7 +260,7 @@ namespace librealsense
                         cur_fill = 0;
                     --p;
                 }
-                p += _width;
+                p += width;
             }
         }
 
@@ -280,6 +281,7 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        std::vector<uint8_t>    _roi_buffer;                // Region of interest (with halo) being filtered
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
@@ -8,13 +8,24 @@
 #include "proc/syncer-processing-block.h"
 #include <src/core/frame-processor-callback.h>
 
+#include <rsutils/json.h>
+
 
 namespace librealsense
 {
     syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
-        : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
-        , _enable_opts(enable_opts.begin(), enable_opts.end())
+        : syncer_process_unit( std::make_shared< composite_identity_matcher >( std::vector< std::shared_ptr< matcher > >() ),
+                               log )
     {
+        _enable_opts.assign( enable_opts.begin(), enable_opts.end() );
+    }
+
+    syncer_process_unit::syncer_process_unit( std::shared_ptr< matcher > top_matcher, bool log )
+        : processing_block("syncer"), _matcher( std::move( top_matcher ) )
+        , _stats( std::make_shared< sync_statistics >() )
+    {
+        set_trace_stages( RS2_FRAME_TRACE_STAGE_SYNC_START, RS2_FRAME_TRACE_STAGE_SYNC_END );
+
         _matcher->set_callback( []( frame_holder f, syncronization_environment const & env ) {
             if( env.log )
             {
@@ -61,7 +72,10 @@ namespace librealsense
                     LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
                     return;
                 }
-                _matcher->dispatch(std::move(frame), { source, _matches, log });
+                auto stats = _active_stats.load();
+                if( stats )
+                    stats->on_arrival( frame.frame );
+                _matcher->dispatch(std::move(frame), { source, _matches, log, stats });
             }
 
             frame_holder f;
@@ -72,9 +86,12 @@ namespace librealsense
                 if (!lock.owns_lock())
                     return;
 
+                auto stats = _active_stats.load();
                 while (_matches.try_dequeue(&f))
                 {
                     LOG_DEBUG( "--> frame ready: " << *f.frame );
+                    if( stats )
+                        stats->on_release( f.frame );
                     get_source().frame_ready(std::move(f));
                 }
             }
@@ -90,5 +107,33 @@ namespace librealsense
     {
         _matcher->stop();
     }
+
+    void syncer_process_unit::enable_statistics( bool enable )
+    {
+        _active_stats = enable ? _stats.get() : nullptr;
+    }
+
+    rsutils::json syncer_process_unit::get_statistics() const
+    {
+        auto j = _stats->to_json();
+        j["enabled"] = _active_stats.load() != nullptr;
+        return j;
+    }
+
+    void syncer_process_unit::reset_statistics()
+    {
+        _stats->reset();
+    }
+
+    rsutils::json syncer_process_unit::get_telemetry() const
+    {
+        auto j = processing_block::get_telemetry();
+        j["queues"] = rsutils::json::array( { { { "name", "matches" },
+                                                { "size", _matches.size() },
+                                                { "capacity", _matches.capacity() } } } );
+        if( _active_stats.load() )
+            j["pending"] = _stats->get_pending();
+        return j;
+    }
 }
 
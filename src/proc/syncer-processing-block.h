@@ -9,15 +9,20 @@
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <atomic>
 
 #include "types.h"
 #include "archive.h"
 #include "option.h"
 
+#include <rsutils/json-fwd.h>
+
 namespace librealsense
 {
     class processing_block;
     class timestamp_composite_matcher;
+    class sync_statistics;
+    class matcher;
     class syncer_process_unit : public processing_block
     {
     public:
@@ -26,6 +31,9 @@ namespace librealsense
         syncer_process_unit( bool_option::ptr is_enabled_opt = nullptr, bool log = true)
             : syncer_process_unit( { is_enabled_opt }, log) {}
 
+        // Syncs using the given top-level matcher instead of syncing each device on its own
+        syncer_process_unit( std::shared_ptr< matcher > top_matcher, bool log = true );
+
         void add_enabling_option( bool_option::ptr is_enabled_opt )
         {
             _enable_opts.push_back( is_enabled_opt );
@@ -35,12 +43,24 @@ namespace librealsense
         // pending dispatch will be lost!
         void stop();
 
+        // Statistics cost every frame a lock and a lookup, so they are only collected once enabled
+        void enable_statistics( bool enable );
+
+        // Hold times, drops and release reasons collected while enabled, since creation (or the last reset)
+        rsutils::json get_statistics() const;
+        void reset_statistics();
+
+        // Adds the occupancy of the output queue and the frames held by the matchers
+        rsutils::json get_telemetry() const override;
+
         ~syncer_process_unit()
         {
             _matcher.reset();
         }
     private:
         std::shared_ptr<matcher> _matcher;
+        std::shared_ptr< sync_statistics > _stats;
+        std::atomic< sync_statistics * > _active_stats{ nullptr };  // _stats while enabled
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
 
         single_consumer_frame_queue<frame_holder> _matches;
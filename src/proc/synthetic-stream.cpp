@@ -13,8 +13,10 @@
 #include "stream.h"
 #include "types.h"
 #include <src/core/time-service.h>
+#include <src/tracing.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 namespace librealsense
@@ -33,13 +35,34 @@ namespace librealsense
     processing_block::processing_block(const char* name) :
         _source_wrapper(_source)
     {
+#ifdef BUILD_WITH_TRACING
+        tracing::start_from_environment();
+        _trace_name = tracing::intern(name);
+#endif
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
         _source.init(std::shared_ptr<metadata_parser_map>());
     }
 
+    void processing_block::set_trace_stages( rs2_frame_trace_stage input, rs2_frame_trace_stage output )
+    {
+        _input_trace_stage = input;
+        _source_wrapper.set_trace_stage( output );
+    }
+
+    rsutils::json processing_block::get_telemetry() const
+    {
+        rsutils::json j;
+        j["archives"] = _source.get_telemetry();
+        return j;
+    }
+
     void processing_block::invoke(frame_holder f)
     {
+        LRS_TRACE_SCOPE( _trace_name );
+        if( _input_trace_stage != RS2_FRAME_TRACE_STAGE_COUNT )
+            trace_frame( f.frame, _input_trace_stage );
+
         frame_source::archive_id id
             = { f->get_stream()->get_stream_type(), f->get_stream()->get_stream_index(), RS2_EXTENSION_VIDEO_FRAME };
         auto callback = _source.begin_callback( id );
@@ -63,13 +86,66 @@ namespace librealsense
         }
     }
 
+    namespace {
+
+    // Forwards to a block's own option, flagging the block's cached option values as stale when it is set
+    class watched_option : public option
+    {
+    public:
+        watched_option(std::shared_ptr<option> watched, std::shared_ptr<std::atomic<bool>> changed)
+            : _watched(std::move(watched)), _changed(std::move(changed))
+        {}
+
+        void set(float value) override
+        {
+            _watched->set(value);
+            _changed->store(true);
+        }
+        void set_value(rsutils::json value) override
+        {
+            _watched->set_value(std::move(value));
+            _changed->store(true);
+        }
+        float query() const override { return _watched->query(); }
+        rsutils::json get_value() const noexcept override { return _watched->get_value(); }
+        rs2_option_type get_value_type() const noexcept override { return _watched->get_value_type(); }
+        option_range get_range() const override { return _watched->get_range(); }
+        bool is_enabled() const override { return _watched->is_enabled(); }
+        bool is_read_only() const override { return _watched->is_read_only(); }
+        const char* get_description() const override { return _watched->get_description(); }
+        const char* get_value_description(float val) const override { return _watched->get_value_description(val); }
+        void enable_recording(std::function<void(const option&)> record_action) override
+        {
+            _watched->enable_recording(std::move(record_action));
+        }
+        void create_snapshot(std::shared_ptr<option>& snapshot) const override { _watched->create_snapshot(snapshot); }
+
+    private:
+        std::shared_ptr<option> _watched;
+        std::shared_ptr<std::atomic<bool>> _changed;
+    };
+
+    }
+
     generic_processing_block::generic_processing_block(const char* name)
         : processing_block(name)
     {
+        // Options set through the block are then noticed without querying them all for every frame; options set
+        // by the block itself, as a side effect, are picked up as well since all values are read again. Those the
+        // base registered are wrapped here, before any frame or user thread may look at them.
+        for (auto&& opt : _options)
+            opt.second = std::make_shared<watched_option>(opt.second, _options_changed);
+
         auto on_frame = [this](rs2::frame f, const rs2::frame_source& source)
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // Only a frame that was handed over to this invocation alone, with data of its own, may be overwritten by
+            // the block
+            auto input = dynamic_cast<librealsense::frame*>((frame_interface*)f.get());
+            _exclusive_input
+                = (input && !f.is<rs2::frameset>() && input->is_exclusive() && input->owns_data()) ? input : nullptr;
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -82,7 +158,7 @@ namespace librealsense
             {
                 if (should_process(f))
                 {
-                    auto res = process_frame(source, f);
+                    auto res = _result_cache_size ? process_frame_cached(source, f) : process_frame(source, f);
                     if (!res) continue;
                     if (auto composite = res.as<rs2::frameset>())
                     {
@@ -99,14 +175,111 @@ namespace librealsense
                         break;
                 }
             }
+            _exclusive_input = nullptr;
 
             auto out = prepare_output(source, f, results);
+
+            // Let go of this block's own references first, so the next block may process the output in place
+            results.clear();
+            frames_to_process.clear();
+            f = rs2::frame();
             if(out)
-                source.frame_ready(out);
+                source.frame_ready(std::move(out));
         };
 
         auto callback = new rs2::frame_processor_callback<decltype(on_frame)>(on_frame);
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
+
+        auto cache_size = std::make_shared<ptr_option<int>>(0, 16, 1, 0, &_result_cache_size, "Result cache size");
+        std::weak_ptr<ptr_option<int>> cache_size_ref = cache_size;
+        cache_size->on_set([this, cache_size_ref](float val)
+        {
+            auto cache_size_strong_ref = cache_size_ref.lock();
+            if (!cache_size_strong_ref) return;
+
+            if (!cache_size_strong_ref->is_valid(val))
+                throw invalid_value_exception( rsutils::string::from()
+                                               << "Unsupported result cache size, " << val << " is out of range." );
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _result_cache_size = (int)val;
+            while (_result_cache.size() > size_t(_result_cache_size))
+                _result_cache.pop_front();
+            _options_changed->store(true);
+        });
+        register_option(RS2_OPTION_RESULT_CACHE_SIZE, cache_size);
+    }
+
+    void generic_processing_block::register_option(rs2_option id, std::shared_ptr<option> option)
+    {
+        options_container::register_option(id, std::make_shared<watched_option>(std::move(option), _options_changed));
+        _options_changed->store(true);
+    }
+
+    rs2::frame generic_processing_block::reuse_input_frame(const rs2::frame& f, const rs2::stream_profile& profile, size_t stride, size_t size) const
+    {
+        auto fi = (frame_interface*)f.get();
+        if (!fi || fi != _exclusive_input || !profile)
+            return {};
+        auto vf = f.as<rs2::video_frame>();
+        if (!vf || size_t(vf.get_stride_in_bytes()) != stride || size_t(vf.get_data_size()) < size)
+            return {};
+
+        fi->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(profile.get()->profile->shared_from_this()));
+        return f;
+    }
+
+    std::vector<double> generic_processing_block::make_cache_key(const rs2::frame& f)
+    {
+        if (_options_changed->exchange(false))
+        {
+            _option_values.clear();
+            for (auto&& opt : _options)
+            {
+                _option_values.push_back(double(opt.first));
+                _option_values.push_back(double(opt.second->query()));
+            }
+        }
+
+        // The key captures the block configuration and the identity of every input frame
+        std::vector<double> key = _option_values;
+        if (!extend_cache_key(f, key))
+            return {};
+
+        auto add_frame = [&key](const rs2::frame& frame)
+        {
+            auto profile = frame.get_profile();
+            key.push_back(double(profile.unique_id()));
+            key.push_back(double(profile.stream_type()));
+            key.push_back(double(profile.stream_index()));
+            key.push_back(double(frame.get_frame_number()));
+            key.push_back(frame.get_timestamp());
+        };
+
+        if (auto composite = f.as<rs2::frameset>())
+            composite.foreach_rs([&](const rs2::frame& frame) { add_frame(frame); });
+        else
+            add_frame(f);
+        return key;
+    }
+
+    rs2::frame generic_processing_block::process_frame_cached(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        auto key = make_cache_key(f);
+        if (key.empty())
+            return process_frame(source, f);
+        auto it = std::find_if(_result_cache.begin(), _result_cache.end(),
+            [&key](const cached_result& r) { return r.key == key; });
+        if (it != _result_cache.end())
+            return it->result;
+
+        auto res = process_frame(source, f);
+
+        // Cached results stay referenced, and so are not recycled by the frame archive until evicted
+        _result_cache.push_back({ std::move(key), res });
+        while (_result_cache.size() > size_t(_result_cache_size))
+            _result_cache.pop_front();
+        return res;
     }
 
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
@@ -233,6 +406,90 @@ namespace librealsense
         register_option(RS2_OPTION_STREAM_INDEX_FILTER, index_selector);
     }
 
+    void stream_filter_processing_block::register_roi_options()
+    {
+        const int max_coordinate = 0xffff;
+        const int max_halo = 64;
+
+        auto make_roi_option = [this](rs2_option id, int* value, int max_value, const char* desc)
+        {
+            auto roi_option = std::make_shared<ptr_option<int>>(0, max_value, 1, 0, value, desc);
+            std::weak_ptr<ptr_option<int>> roi_option_ref = roi_option;
+            roi_option->on_set([this, roi_option_ref, value](float val)
+            {
+                auto roi_option_strong_ref = roi_option_ref.lock();
+                if (!roi_option_strong_ref) return;
+
+                if (!roi_option_strong_ref->is_valid(val))
+                    throw invalid_value_exception( rsutils::string::from()
+                                                   << "Unsupported region of interest value, " << val << " is out of range." );
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                *value = (int)val;
+            });
+            register_option(id, roi_option);
+        };
+
+        make_roi_option(RS2_OPTION_FILTER_ROI_MIN_X, &_roi.min_x, max_coordinate, "Region of interest left edge, in pixels");
+        make_roi_option(RS2_OPTION_FILTER_ROI_MIN_Y, &_roi.min_y, max_coordinate, "Region of interest top edge, in pixels");
+        make_roi_option(RS2_OPTION_FILTER_ROI_MAX_X, &_roi.max_x, max_coordinate, "Region of interest right edge (exclusive), 0 = whole frame");
+        make_roi_option(RS2_OPTION_FILTER_ROI_MAX_Y, &_roi.max_y, max_coordinate, "Region of interest bottom edge (exclusive), 0 = whole frame");
+        make_roi_option(RS2_OPTION_FILTER_ROI_HALO, &_roi.halo, max_halo, "Context pixels processed around the region of interest");
+    }
+
+    bool stream_filter_processing_block::get_roi_window(int frame_width, int frame_height, roi_window& window) const
+    {
+        return resolve_roi(_roi, frame_width, frame_height, window);
+    }
+
+    bool resolve_roi(const processing_roi& roi, int frame_width, int frame_height, roi_window& window)
+    {
+        if (!roi.enabled())
+            return false;
+
+        int x0 = std::max(0, std::min(roi.min_x, frame_width));
+        int y0 = std::max(0, std::min(roi.min_y, frame_height));
+        int x1 = std::max(0, std::min(roi.max_x, frame_width));
+        int y1 = std::max(0, std::min(roi.max_y, frame_height));
+
+        if (x0 == 0 && y0 == 0 && x1 == frame_width && y1 == frame_height)
+            return false;
+
+        // A region lying entirely outside the frame leaves nothing to compute
+        if (x1 <= x0 || y1 <= y0)
+        {
+            window = roi_window();
+            return true;
+        }
+
+        int hx0 = std::max(0, x0 - roi.halo);
+        int hy0 = std::max(0, y0 - roi.halo);
+        int hx1 = std::min(frame_width, x1 + roi.halo);
+        int hy1 = std::min(frame_height, y1 + roi.halo);
+
+        window.x = x0;
+        window.y = y0;
+        window.width = x1 - x0;
+        window.height = y1 - y0;
+        window.halo_x = hx0;
+        window.halo_y = hy0;
+        window.halo_width = hx1 - hx0;
+        window.halo_height = hy1 - hy0;
+        return true;
+    }
+
+    void copy_rect(const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t row_bytes, size_t rows)
+    {
+        auto from = static_cast<const uint8_t*>(src);
+        auto to = static_cast<uint8_t*>(dst);
+        for (size_t i = 0; i < rows; ++i)
+        {
+            memcpy(to, from, row_bytes);
+            from += src_stride;
+            to += dst_stride;
+        }
+    }
+
     functional_processing_block::functional_processing_block(const char * name, rs2_format target_format, rs2_stream target_stream, rs2_extension extension_type) :
         stream_filter_processing_block(name), _target_format(target_format), _target_stream(target_stream), _extension_type(extension_type) {}
 
@@ -249,7 +506,17 @@ namespace librealsense
 
     rs2::frame functional_processing_block::process_frame(const rs2::frame_source & source, const rs2::frame & f)
     {
-        auto&& ret = prepare_frame(source, f);
+        rs2::frame ret;
+        if (supports_in_place())
+        {
+            init_profiles_info(&f);
+            auto in = f.as<rs2::video_frame>();
+            if (in && in.get_bytes_per_pixel() == _target_bpp)
+                ret = reuse_input_frame(f, _target_stream_profile, in.get_width() * _target_bpp,
+                                        in.get_height() * in.get_width() * _target_bpp);
+        }
+        if (!ret)
+            ret = prepare_frame(source, f);
         int width = 0;
         int height = 0;
         int raw_size = 0;
@@ -338,6 +605,8 @@ namespace librealsense
 
     void synthetic_source::frame_ready(frame_holder result)
     {
+        if( _trace_stage != RS2_FRAME_TRACE_STAGE_COUNT )
+            trace_frame( result.frame, _trace_stage );
         _actual_source.invoke_callback(std::move(result));
     }
 
@@ -353,6 +622,8 @@ namespace librealsense
             data.metadata_size = 0;
             data.system_time = time_service::get_time();
             data.is_blocking = original->is_blocking();
+            if( auto of = dynamic_cast< frame * >( original ) )
+                data.trace = of->additional_data.trace;
 
             auto res = _actual_source.alloc_frame(
                 { vid_stream->get_stream_type(), vid_stream->get_stream_index(), frame_type },
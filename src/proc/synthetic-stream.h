@@ -13,6 +13,8 @@
 #include <librealsense2/hpp/rs_frame.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
 
+#include <deque>
+
 namespace librealsense
 {
 
@@ -45,9 +47,13 @@ namespace librealsense
 
         rs2_source* get_rs2_source() const { return _c_wrapper.get(); }
 
+        // The hop recorded on every output frame when frame tracing is enabled; RS2_FRAME_TRACE_STAGE_COUNT for none
+        void set_trace_stage( rs2_frame_trace_stage stage ) { _trace_stage = stage; }
+
     private:
         frame_source & _actual_source;
         std::shared_ptr<rs2_source> _c_wrapper;
+        rs2_frame_trace_stage _trace_stage = RS2_FRAME_TRACE_STAGE_PROCESSING_END;
     };
 
     class LRS_EXTENSION_API processing_block : public processing_block_interface, public options_container, public info_container
@@ -57,15 +63,27 @@ namespace librealsense
 
         void set_processing_callback( rs2_frame_processor_callback_sptr callback) override;
         void set_output_callback( rs2_frame_callback_sptr callback) override;
+        virtual rs2_frame_callback_sptr get_output_callback() const { return _source.get_callback(); }
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
 
+        // The hops recorded on the input and output frames when frame tracing is enabled, for blocks that are a
+        // stage of their own (format conversion, syncer); RS2_FRAME_TRACE_STAGE_COUNT records nothing
+        void set_trace_stages( rs2_frame_trace_stage input, rs2_frame_trace_stage output );
+
+        // Frame memory and queue occupancy counters, as JSON
+        virtual rsutils::json get_telemetry() const;
+
         virtual ~processing_block() { _source.flush(); }
     protected:
         frame_source _source;
         std::mutex _mutex;
         rs2_frame_processor_callback_sptr _callback;
         synthetic_source _source_wrapper;
+        rs2_frame_trace_stage _input_trace_stage = RS2_FRAME_TRACE_STAGE_PROCESSING_START;
+#ifdef BUILD_WITH_TRACING
+        const char * _trace_name;  // Interned, for trace spans
+#endif
     };
 
     class LRS_EXTENSION_API generic_processing_block : public processing_block
@@ -74,11 +92,46 @@ namespace librealsense
         generic_processing_block(const char* name);
         virtual ~generic_processing_block() { _source.flush(); }
 
+        // Options are wrapped as they are registered, so that setting one marks the cached option values as stale
+        void register_option(rs2_option id, std::shared_ptr<option> option);
+
     protected:
         virtual rs2::frame prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results);
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // Returns the input frame itself, retargeted to 'profile', when nothing but the current invocation refers
+        // to it and it's laid out as the output would be ('stride' bytes per line, at least 'size' bytes): the block
+        // may then write its output over the input instead of allocating and copying into a new frame. Returns an
+        // empty frame otherwise.
+        rs2::frame reuse_input_frame(const rs2::frame& f, const rs2::stream_profile& profile, size_t stride, size_t size) const;
+
+        // The result cache key covers the block's options and the input frames; a block whose result depends on
+        // anything else adds it to the key here, or returns false when its results must not be reused at all (e.g.,
+        // they depend on the frames processed earlier)
+        virtual bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const { return true; }
+
+    private:
+        // Opt-in memoization (RS2_OPTION_RESULT_CACHE_SIZE): when several consumers push the same
+        // frame through this block, the result produced the first time is handed out again as long
+        // as the block's options did not change in between
+        struct cached_result
+        {
+            std::vector<double> key;
+            rs2::frame result;
+        };
+
+        rs2::frame process_frame_cached(const rs2::frame_source& source, const rs2::frame& f);
+        // Empty if the result must not be reused
+        std::vector<double> make_cache_key(const rs2::frame& f);
+
+        int _result_cache_size = 0;
+        std::deque<cached_result> _result_cache;
+        // The options' ids and values, as part of the cache key: re-read only when an option was set
+        std::vector<double> _option_values;
+        std::shared_ptr<std::atomic<bool>> _options_changed = std::make_shared<std::atomic<bool>>(true);
+        frame_interface* _exclusive_input = nullptr;
     };
 
     struct stream_filter
@@ -131,6 +184,43 @@ namespace librealsense
         }
     };
 
+    // Rectangular region of interest restricting the pixels a post-processing block computes.
+    // Coordinates are in input-frame pixels, max edges are exclusive. An empty region (the default)
+    // selects the whole frame.
+    struct processing_roi
+    {
+        int min_x = 0;
+        int min_y = 0;
+        int max_x = 0;
+        int max_y = 0;
+        int halo = 0;   // Context pixels around the region, used by neighbourhood filters
+
+        bool enabled() const { return max_x > min_x && max_y > min_y; }
+    };
+
+    // A processing_roi resolved against the dimensions of an actual frame
+    struct roi_window
+    {
+        // The region of interest, clipped to the frame
+        int x = 0, y = 0, width = 0, height = 0;
+        // The region grown by the halo, clipped to the frame
+        int halo_x = 0, halo_y = 0, halo_width = 0, halo_height = 0;
+
+        bool operator==(const roi_window& other) const
+        {
+            return x == other.x && y == other.y && width == other.width && height == other.height
+                && halo_x == other.halo_x && halo_y == other.halo_y
+                && halo_width == other.halo_width && halo_height == other.halo_height;
+        }
+        bool operator!=(const roi_window& other) const { return !(*this == other); }
+    };
+
+    // Returns false when the region is disabled or covers the whole frame, i.e. there is nothing to restrict
+    bool resolve_roi(const processing_roi& roi, int frame_width, int frame_height, roi_window& window);
+
+    // Copies a 'rows' x 'row_bytes' rectangle between two buffers with independent strides
+    void copy_rect(const void* src, size_t src_stride, void* dst, size_t dst_stride, size_t row_bytes, size_t rows);
+
     class LRS_EXTENSION_API stream_filter_processing_block : public generic_processing_block
     {
     public:
@@ -139,8 +229,13 @@ namespace librealsense
 
     protected:
         stream_filter _stream_filter;
+        processing_roi _roi;
 
         bool should_process(const rs2::frame& frame) override;
+
+        // Exposes _roi through the RS2_OPTION_FILTER_ROI_* options, for blocks that honor it
+        void register_roi_options();
+        bool get_roi_window(int frame_width, int frame_height, roi_window& window) const;
     };
 
     // process frames with a given function
@@ -154,6 +249,9 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source & source, const rs2::frame & f) override;
         virtual rs2::frame prepare_frame(const rs2::frame_source& source, const rs2::frame& f);
         virtual void process_function(uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) = 0;
+        // Blocks whose process_function tolerates dest[0] == source (same bpp, each pixel read before it is written)
+        // may have their output written over an exclusively owned input frame
+        virtual bool supports_in_place() const { return false; }
 
         rs2::stream_profile _target_stream_profile;
         rs2::stream_profile _source_stream_profile;
@@ -255,6 +353,7 @@ namespace librealsense
         processing_block& get(rs2_option option);
         void add(std::shared_ptr<processing_block> block);
         void set_output_callback(rs2_frame_callback_sptr callback) override;
+        rs2_frame_callback_sptr get_output_callback() const override { return _processing_blocks.back()->get_output_callback(); }
         void invoke(frame_holder frames) override;
 
     protected:
@@ -42,7 +42,8 @@ namespace librealsense
         _delta_param(temp_delta_default),
         _width(0), _height(0), _stride(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
-        _current_frm_size_pixels(0)
+        _current_frm_size_pixels(0),
+        _roi_enabled(false)
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -112,6 +113,7 @@ namespace librealsense
 
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, temporal_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, temporal_filter_delta);
+        register_roi_options();
 
         on_set_persistence_control(_persistence_param);
         on_set_delta(_delta_param);
@@ -121,6 +123,29 @@ namespace librealsense
     rs2::frame temporal_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         update_configuration(f);
+
+        roi_window window;
+        bool roi_enabled = get_roi_window(int(_width), int(_height), window);
+        if (roi_enabled != _roi_enabled || (roi_enabled && window != _roi_window))
+        {
+            // Pixels that left the region carry no valid history
+            _roi_enabled = roi_enabled;
+            _roi_window = window;
+            _cur_frame_index = 0;
+            std::fill(_last_frame.begin(), _last_frame.end(), uint8_t(0));
+            std::fill(_history.begin(), _history.end(), uint8_t(0));
+        }
+
+        if (roi_enabled)
+        {
+            auto tgt = prepare_target_roi(f, source, window);
+            if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+                temp_jw_smooth_roi<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data(), window);
+            else
+                temp_jw_smooth_roi<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data(), window);
+            return tgt;
+        }
+
         auto tgt = prepare_target_frame(f, source);
 
         // Temporal filter execution
@@ -188,13 +213,28 @@ namespace librealsense
 
     rs2::frame temporal_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the original Depth data to the target
+        if (auto tgt = reuse_input_frame(f, _target_stream_profile, _stride, _current_frm_size_pixels * _bpp))
+            return tgt;
+
+        // Otherwise, allocate and copy the content of the original Depth data to the target
         rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height, (int)_stride, _extension_type);
 
         memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
         return tgt;
     }
 
+    rs2::frame temporal_filter::prepare_target_roi(const rs2::frame& f, const rs2::frame_source& source, const roi_window& window)
+    {
+        // Copy only the region of interest; the rest of the target is marked invalid
+        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height, (int)_stride, _extension_type);
+
+        auto tgt_data = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+        auto offset = window.y * _stride + window.x * _bpp;
+        memset(tgt_data, 0, _current_frm_size_pixels * _bpp);
+        copy_rect(static_cast<const uint8_t*>(f.get_data()) + offset, _stride, tgt_data + offset, _stride, window.width * _bpp, window.height);
+        return tgt;
+    }
+
     void temporal_filter::recalc_persistence_map()
     {
         _persistence_map.fill(0);
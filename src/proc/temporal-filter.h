@@ -16,11 +16,33 @@ namespace librealsense
     protected:
         void    update_configuration(const rs2::frame& f);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        // The result depends on the history of earlier frames
+        bool extend_cache_key(const rs2::frame& f, std::vector<double>& key) const override { return false; }
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+        rs2::frame prepare_target_roi(const rs2::frame& f, const rs2::frame_source& source, const roi_window& window);
 
         template<typename T>
         void temp_jw_smooth(void* frame_data, void * _last_frame_data, uint8_t *history)
+        {
+            // pass one -- go through image and update all
+            temp_jw_smooth_span<T>(frame_data, _last_frame_data, history, 0, _current_frm_size_pixels);
+
+            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        }
+
+        template<typename T>
+        void temp_jw_smooth_roi(void* frame_data, void * _last_frame_data, uint8_t *history, const roi_window& window)
+        {
+            // The filter is per-pixel, so restricting it to the region requires no halo
+            for (int v = window.y; v < window.y + window.height; v++)
+                temp_jw_smooth_span<T>(frame_data, _last_frame_data, history, v * _width + window.x, window.width);
+
+            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        }
+
+        template<typename T>
+        void temp_jw_smooth_span(void* frame_data, void * _last_frame_data, uint8_t *history, size_t first, size_t count)
         {
             static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
 
@@ -33,8 +55,7 @@ namespace librealsense
 
             unsigned char mask = 1 << _cur_frame_index;
 
-            // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            for (size_t i = first; i < first + count; i++)
             {
                 T cur_val = frame[i];
                 T prev_val = _last_frame[i];
@@ -79,8 +100,6 @@ namespace librealsense
                     history[i] &= ~mask;
                 }
             }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
 
     private:
@@ -103,6 +122,8 @@ namespace librealsense
         std::vector<uint8_t>    _last_frame;                // Hold the last frame received for the current profile
         std::vector<uint8_t>    _history;                   // represents the history over the last 8 frames, 1 bit per frame
         uint8_t                 _cur_frame_index;
+        bool                    _roi_enabled;               // Whether the history was accumulated over _roi_window only
+        roi_window              _roi_window;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
     };
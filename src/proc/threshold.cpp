@@ -47,8 +47,13 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
-        auto new_f = source.allocate_video_frame(_target_stream_profile, f,
-            vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
+        // Thresholding is done pixel by pixel, so an input nobody else holds can be overwritten
+        rs2::frame new_f;
+        if (vf.get_profile().format() == RS2_FORMAT_Z16)
+            new_f = reuse_input_frame(f, _target_stream_profile, vf.get_stride_in_bytes(), width * height * sizeof(uint16_t));
+        if (!new_f)
+            new_f = source.allocate_video_frame(_target_stream_profile, f,
+                vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
         if (new_f)
         {
@@ -66,11 +71,10 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
             for (int i = 0; i < width * height; i++)
             {
                 auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
+                new_data[i] = (dist >= _min && dist <= _max) ? depth_data[i] : 0;
             }
 
             return new_f;
@@ -5,6 +5,7 @@
 
 #include "api.h"
 #include "log.h"
+#include "tracing.h"
 #include "context.h"
 #include "device.h"
 #include "algo.h"
@@ -14,6 +15,7 @@
 #include "media/playback/playback-device-info.h"
 #include "media/record/record_device.h"
 #include <media/ros/ros_writer.h>
+#include <media/raw/raw_writer.h>
 #include <media/ros/ros_reader.h>
 #include "core/advanced_mode.h"
 #include "core/pose-frame.h"
@@ -29,6 +31,7 @@
 #include "proc/units-transform.h"
 #include "proc/disparity-transform.h"
 #include "proc/syncer-processing-block.h"
+#include "sync.h"
 #include "proc/decimation-filter.h"
 #include "proc/spatial-filter.h"
 #include "proc/hole-filling-filter.h"
@@ -37,6 +40,9 @@
 #include "proc/rates-printer.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
+#include "proc/rvl-codec.h"
+#include "proc/processing-graph.h"
+#include "proc/batch-processor.h"
 #include "media/playback/playback_device.h"
 #include "stream.h"
 #include <librealsense2/h/rs_types.h>
@@ -986,6 +992,17 @@ int rs2_supports_sensor_info(const rs2_sensor* sensor, rs2_camera_info info, rs2
 }
 HANDLE_EXCEPTIONS_AND_RETURN(false, sensor, info)
 
+rs2_raw_data_buffer* rs2_get_sensor_telemetry(const rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    auto base = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! base )
+        throw librealsense::not_implemented_exception( "sensor does not provide telemetry" );
+    auto str = base->get_telemetry().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
+
 
 rs2_frame_callback_sptr make_user_frame_callback( rs2_frame_callback_ptr on_frame, void * user )
 {
@@ -1228,6 +1245,68 @@ int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+int rs2_get_frame_metadata_values(const rs2_frame* frame, rs2_metadata_type* values, unsigned char* is_valid, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(values);
+    VALIDATE_NOT_NULL(is_valid);
+    VALIDATE_GT(count, 0);
+    auto f = (frame_interface*)frame;
+    // The metadata of a frameset is that of its first frame; resolve it once rather than per value
+    if (auto composite = dynamic_cast<composite_frame*>(f))
+        if (composite->get_embedded_frames_count())
+            f = composite->first();
+    int n_valid = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        values[i] = 0;
+        is_valid[i] = i < RS2_FRAME_METADATA_COUNT
+                   && f->find_metadata(static_cast<rs2_frame_metadata_value>(i), &values[i]);
+        n_valid += is_valid[i];
+    }
+    return n_valid;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, values, is_valid, count)
+
+void rs2_enable_frame_trace(int enable, rs2_error** error) BEGIN_API_CALL
+{
+    frame_trace::enable(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, enable)
+
+// The events of a frameset are those of its first frame, like the rest of its header
+static frame_trace const & get_frame_trace(const rs2_frame* frame)
+{
+    auto f = (frame_interface*)frame;
+    if (auto composite = dynamic_cast<composite_frame*>(f))
+        if (composite->get_embedded_frames_count())
+            f = composite->first();
+    auto single = dynamic_cast<librealsense::frame*>(f);
+    if (!single)
+        throw invalid_value_exception("frame does not support tracing");
+    return single->additional_data.trace;
+}
+
+int rs2_get_frame_trace_size(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    return static_cast<int>(get_frame_trace(frame).size());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+void rs2_get_frame_trace_event(const rs2_frame* frame, int index, rs2_frame_trace_stage* stage, rs2_time_t* time, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(stage);
+    VALIDATE_NOT_NULL(time);
+    auto& trace = get_frame_trace(frame);
+    VALIDATE_RANGE(index, 0, static_cast<int>(trace.size()) - 1);
+    auto e = trace.get(index);
+    *stage = e.stage;
+    *time = e.time;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame, index)
+
 rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1493,6 +1572,7 @@ rs2_frame* rs2_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, r
 
     frame_interface* result = nullptr;
     std::swap(result, fh.frame);
+    trace_frame(result, RS2_FRAME_TRACE_STAGE_DELIVERY);
     return (rs2_frame*)result;
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, queue)
@@ -1506,6 +1586,7 @@ int rs2_poll_for_frame(rs2_frame_queue* queue, rs2_frame** output_frame, rs2_err
     {
         frame_interface* result = nullptr;
         std::swap(result, fh.frame);
+        trace_frame(result, RS2_FRAME_TRACE_STAGE_DELIVERY);
         *output_frame = (rs2_frame*)result;
         return true;
     }
@@ -1526,6 +1607,7 @@ int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_
 
     frame_interface* result = nullptr;
     std::swap(result, fh.frame);
+    trace_frame(result, RS2_FRAME_TRACE_STAGE_DELIVERY);
     *output_frame = (rs2_frame*)result;
     return true;
 }
@@ -1556,6 +1638,13 @@ int rs2_frame_queue_size(rs2_frame_queue* queue, rs2_error** error) BEGIN_API_CA
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, queue)
 
+void rs2_set_frame_queue_conflating(rs2_frame_queue* queue, int conflating, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(queue);
+    queue->queue.set_conflating(conflating != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, queue, conflating)
+
 void rs2_get_extrinsics(const rs2_stream_profile* from,
     const rs2_stream_profile* to,
     rs2_extrinsics* extrin, rs2_error** error) BEGIN_API_CALL
@@ -1708,6 +1797,29 @@ void rs2_enable_rolling_log_file( unsigned max_size, rs2_error ** error ) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, max_size)
 
+void rs2_start_trace( const char * file_path, rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( file_path );
+#ifdef BUILD_WITH_TRACING
+    librealsense::tracing::start( file_path );
+#else
+    throw librealsense::not_implemented_exception( "librealsense was built without tracing support" );
+#endif
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, file_path)
+
+void rs2_stop_trace( rs2_error ** error ) BEGIN_API_CALL
+{
+    librealsense::tracing::stop();
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN_VOID()
+
+void rs2_enable_async_logging( int enable, rs2_error ** error ) BEGIN_API_CALL
+{
+    librealsense::async_log::enable( enable != 0 );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, enable)
+
 // librealsense wrapper around a C function
 class on_log_callback : public rs2_log_callback
 {
@@ -2011,6 +2123,56 @@ int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+void rs2_playback_device_set_max_throughput(const rs2_device* device, int max_throughput, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_max_throughput(max_throughput == 0 ? false : true);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device)
+
+int rs2_playback_device_is_max_throughput(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->is_max_throughput() ? 1 : 0;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device)
+
+rs2_frame* rs2_playback_device_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long frame_number, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    auto f = playback->get_frame(*profile->profile, frame_number);
+    auto frame = f.frame;
+    f.frame = nullptr;
+    return (rs2_frame*)(frame);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, profile, frame_number)
+
+rs2_frame* rs2_playback_device_get_frames_at(const rs2_device* device, const rs2_stream_profile** profiles, int count, long long int time, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_LE(0, count);
+    if (count)
+        VALIDATE_NOT_NULL(profiles);
+    VALIDATE_LE(0, time);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+
+    std::vector<std::shared_ptr<stream_interface>> streams;
+    for (auto i = 0; i < count; i++)
+    {
+        VALIDATE_NOT_NULL(profiles[i]);
+        streams.push_back(std::dynamic_pointer_cast<stream_interface>(profiles[i]->profile->shared_from_this()));
+    }
+    auto f = playback->get_frames_at(streams, std::chrono::nanoseconds(time));
+    auto frame = f.frame;
+    f.frame = nullptr;
+    return (rs2_frame*)(frame);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, profiles, count, time)
+
 void rs2_playback_device_set_status_changed_callback(const rs2_device* device, rs2_playback_status_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2077,6 +2239,76 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_with_settings(const rs2_device* device, const char* file, const char* json_settings, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(device->device);
+    VALIDATE_NOT_NULL(file);
+
+    auto settings = ( ! json_settings || ! *json_settings ) ? json::object() : json::parse( json_settings );
+    if( ! settings.is_object() )
+        throw invalid_value_exception( "record settings must be a JSON object" );
+    bool const compression = settings.nested( "compression" ).default_value( device->device->compress_while_record() );
+    auto const depth_codec = settings.nested( "depth-codec" ).default_value( std::string( "none" ) );
+    if( depth_codec != "none" && depth_codec != "rvl" )
+        throw invalid_value_exception( "invalid depth-codec '" + depth_codec + "'; expecting 'none' or 'rvl'" );
+    bool const index = settings.nested( "index" ).default_value( false );
+    auto const format = settings.nested( "format" ).default_value( std::string( "bag" ) );
+    if( format != "bag" && format != "raw" )
+        throw invalid_value_exception( "invalid format '" + format + "'; expecting 'bag' or 'raw'" );
+    double const pre_trigger = settings.nested( "pre-trigger" ).default_value( 0. );
+    if( pre_trigger < 0 )
+        throw invalid_value_exception( "invalid pre-trigger " + std::to_string( pre_trigger ) + "; expecting seconds >= 0" );
+    double const pre_trigger_memory = settings.nested( "pre-trigger-memory" ).default_value( 1024. );
+    if( pre_trigger_memory <= 0 )
+        throw invalid_value_exception( "invalid pre-trigger-memory " + std::to_string( pre_trigger_memory ) + "; expecting MB > 0" );
+
+    record_queue_settings queue;
+    auto const queue_policy = settings.nested( "queue-policy" ).default_value( std::string( "unbounded" ) );
+    if( queue_policy == "unbounded" )
+        queue.policy = record_queue_policy::unbounded;
+    else if( queue_policy == "block" )
+        queue.policy = record_queue_policy::block;
+    else if( queue_policy == "drop-newest" )
+        queue.policy = record_queue_policy::drop_newest;
+    else if( queue_policy == "drop-by-priority" )
+        queue.policy = record_queue_policy::drop_by_priority;
+    else
+        throw invalid_value_exception( "invalid queue-policy '" + queue_policy
+                                       + "'; expecting 'unbounded', 'block', 'drop-newest' or 'drop-by-priority'" );
+    double const queue_memory = settings.nested( "queue-memory" ).default_value( double( record_device::MAX_CACHED_DATA_SIZE ) / ( 1 << 20 ) );
+    if( queue_memory <= 0 )
+        throw invalid_value_exception( "invalid queue-memory " + std::to_string( queue_memory ) + "; expecting MB > 0" );
+    queue.memory_limit = uint64_t( queue_memory * ( 1 << 20 ) );
+    for( auto && priority : settings.nested( "stream-priority" ).default_object().items() )
+    {
+        int stream = RS2_STREAM_ANY;
+        while( stream < RS2_STREAM_COUNT && priority.key() != rs2_stream_to_string( rs2_stream( stream ) ) )
+            ++stream;
+        if( stream == RS2_STREAM_COUNT )
+            throw invalid_value_exception( "invalid stream-priority stream '" + priority.key() + "'" );
+        queue.stream_priority[rs2_stream( stream )] = priority.value().get< int >();
+    }
+
+    std::shared_ptr< device_serializer::writer > writer;
+    if( format == "raw" )
+    {
+        if( depth_codec != "none" )
+            throw invalid_value_exception( "depth-codec is not supported with the raw format, whose frames are written as is" );
+        writer = std::make_shared< raw_writer >( file, compression, index );
+    }
+    else
+        writer = std::make_shared< ros_writer >( file, compression, depth_codec == "rvl", index );
+
+    return new rs2_device({
+        std::make_shared<record_device>(device->device, writer,
+                                        std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::duration< double >( pre_trigger ) ),
+                                        uint64_t( pre_trigger_memory * ( 1 << 20 ) ),
+                                        queue)
+        });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file, json_settings)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2093,6 +2325,37 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error) BEGIN
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_record_device_trigger(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->trigger();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device)
+
+void rs2_record_device_get_frame_counts(const rs2_device* device, rs2_stream stream, int index,
+                                        unsigned long long* frames_written, unsigned long long* frames_dropped, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(stream);
+    VALIDATE_NOT_NULL(frames_written);
+    VALIDATE_NOT_NULL(frames_dropped);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    auto counts = record_device->get_frame_counts(stream, index);
+    *frames_written = counts.written;
+    *frames_dropped = counts.dropped;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stream, index, frames_written, frames_dropped)
+
+void rs2_record_device_get_queue_telemetry(const rs2_device* device, rs2_record_queue_telemetry* telemetry, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(telemetry);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    *telemetry = record_device->get_queue_telemetry();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, telemetry)
+
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2298,6 +2561,15 @@ rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
 
+rs2_raw_data_buffer* rs2_pipeline_get_start_report(rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+
+    auto str = pipe->pipeline->get_start_report().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
+
 rs2_device* rs2_pipeline_profile_get_device(rs2_pipeline_profile* profile, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(profile);
@@ -2395,6 +2667,14 @@ void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, config, file)
 
+void rs2_config_set_conflating(rs2_config* config, int conflating, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+
+    config->config->set_conflating(conflating != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, conflating)
+
 void rs2_config_disable_stream(rs2_config* config, rs2_stream stream, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(config);
@@ -2518,6 +2798,57 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(float tolerance_ms, float max_wait_ms, rs2_error** error) BEGIN_API_CALL
+{
+    auto matcher = std::make_shared< librealsense::multi_device_composite_matcher >( tolerance_ms, max_wait_ms );
+    auto block = std::make_shared< librealsense::syncer_process_unit >( matcher );
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, tolerance_ms, max_wait_ms)
+
+rs2_raw_data_buffer* rs2_get_syncer_statistics(rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto syncer = std::dynamic_pointer_cast< librealsense::syncer_process_unit >( block->block );
+    if( ! syncer )
+        throw librealsense::invalid_value_exception( "processing block is not a syncer" );
+    auto str = syncer->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, block)
+
+void rs2_enable_syncer_statistics(rs2_processing_block* block, int enable, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto syncer = std::dynamic_pointer_cast< librealsense::syncer_process_unit >( block->block );
+    if( ! syncer )
+        throw librealsense::invalid_value_exception( "processing block is not a syncer" );
+    syncer->enable_statistics( enable != 0 );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, enable)
+
+void rs2_reset_syncer_statistics(rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto syncer = std::dynamic_pointer_cast< librealsense::syncer_process_unit >( block->block );
+    if( ! syncer )
+        throw librealsense::invalid_value_exception( "processing block is not a syncer" );
+    syncer->reset_statistics();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block)
+
+rs2_raw_data_buffer* rs2_get_processing_block_telemetry(rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto pb = std::dynamic_pointer_cast< librealsense::processing_block >( block->block );
+    if( ! pb )
+        throw librealsense::not_implemented_exception( "processing block does not provide telemetry" );
+    auto str = pb->get_telemetry().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, block)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2562,6 +2893,42 @@ void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error*
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, frame)
 
+void rs2_process_frames(rs2_processing_block** blocks, int block_count, rs2_frame** frames, int frame_count, rs2_frame** results, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(blocks);
+    VALIDATE_RANGE(block_count, 1, std::numeric_limits<int>::max());
+    VALIDATE_RANGE(frame_count, 0, std::numeric_limits<int>::max());
+    if (frame_count)
+    {
+        VALIDATE_NOT_NULL(frames);
+        VALIDATE_NOT_NULL(results);
+        for (int k = 0; k < frame_count; ++k)
+            VALIDATE_NOT_NULL(frames[k]);
+    }
+
+    std::vector<std::shared_ptr<processing_block>> chain;
+    for (int i = 0; i < block_count; ++i)
+    {
+        VALIDATE_NOT_NULL(blocks[i]);
+        auto block = std::dynamic_pointer_cast<processing_block>(blocks[i]->block);
+        if (!block)
+            throw not_implemented_exception("Processing block does not support batch processing");
+        chain.push_back(block);
+    }
+
+    std::vector<frame_holder> batch;
+    for (int k = 0; k < frame_count; ++k)
+        batch.emplace_back((frame_interface*)frames[k]);
+
+    auto processed = batch_processor(chain).process(std::move(batch));
+    for (int k = 0; k < frame_count; ++k)
+    {
+        results[k] = (rs2_frame*)processed[k].frame;
+        processed[k].frame = nullptr;
+    }
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, blocks, block_count, frames, frame_count)
+
 void rs2_delete_processing_block(rs2_processing_block* block) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -2770,6 +3137,28 @@ rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error) BEGIN_API
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_rvl_encoder_block(rs2_error** error) BEGIN_API_CALL
+{
+    return new rs2_processing_block{ std::make_shared<librealsense::rvl_encoder>() };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_rvl_decoder_block(rs2_error** error) BEGIN_API_CALL
+{
+    return new rs2_processing_block{ std::make_shared<librealsense::rvl_decoder>() };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_processing_graph(const char* json_description, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(json_description);
+
+    auto block = std::make_shared<librealsense::processing_graph>(json::parse(json_description));
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, json_description)
+
 float rs2_get_depth_scale(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
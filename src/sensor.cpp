@@ -14,6 +14,7 @@
 #include "platform/uvc-option.h"
 #include "core/depth-frame.h"
 #include "core/stream-profile-interface.h"
+#include "async-log.h"
 #include "core/frame-callback.h"
 #include "core/notification.h"
 #include <src/metadata-parser.h>
@@ -39,7 +40,7 @@ void log_callback_end( uint32_t fps,
     auto callback_warning_duration = 1000.f / ( fps + 1 );
     auto callback_duration = current_time - callback_start_time;
 
-    LOG_DEBUG( "CallbackFinished," << librealsense::get_string( stream_type ) << ",#" << std::dec
+    LOG_DEBUG_HOT( "CallbackFinished," << librealsense::get_string( stream_type ) << ",#" << std::dec
                                    << frame_number << ",@" << std::fixed << current_time
                                    << ", callback duration: " << callback_duration << " ms" );
 
@@ -267,6 +268,13 @@ void log_callback_end( uint32_t fps,
         return *_owner;
     }
 
+    rsutils::json sensor_base::get_telemetry() const
+    {
+        rsutils::json j;
+        j["archives"] = _source.get_telemetry();
+        return j;
+    }
+
     // TODO - make this method more efficient, using parralel computation, with SSE or CUDA, when available
     std::vector<uint8_t> sensor_base::align_width_to_64(int width, int height, int bpp, uint8_t * pix) const
     {
@@ -738,4 +746,19 @@ void log_callback_end( uint32_t fps,
         _options_watcher.unregister_option( id );
     }
 
+    rsutils::json synthetic_sensor::get_telemetry() const
+    {
+        auto j = _raw_sensor->get_telemetry();
+        auto & converters = j["converters"] = rsutils::json::array();
+
+        std::lock_guard< std::mutex > lock( _synthetic_configure_lock );
+        for( auto & pb : _formats_converter.get_active_converters() )
+        {
+            auto jc = pb->get_telemetry();
+            jc["name"] = pb->get_info( RS2_CAMERA_INFO_NAME );
+            converters.push_back( std::move( jc ) );
+        }
+        return j;
+    }
+
 }
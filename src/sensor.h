@@ -81,6 +81,9 @@ namespace librealsense
         virtual void set_frame_metadata_modifier(on_frame_md callback) { _metadata_modifier = callback; }
         device_interface& get_device() override;
 
+        // Frame memory counters, as JSON: published frames, freelist and allocations of each frame archive
+        virtual rsutils::json get_telemetry() const;
+
         // Make sensor inherit its owning device info by default
         const std::string& get_info(rs2_camera_info info) const override;
         bool supports_info(rs2_camera_info info) const override;
@@ -252,13 +255,16 @@ namespace librealsense
 
         rsutils::subscription register_options_changed_callback( options_watcher::callback && cb ) override;
         virtual void register_option_to_update( rs2_option id, std::shared_ptr< option > option );
+
+        // Those of the raw sensor, plus those of the active format converters
+        rsutils::json get_telemetry() const override;
         virtual void unregister_option_from_update( rs2_option id );
 
     private:
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
 
-        std::mutex _synthetic_configure_lock;
+        mutable std::mutex _synthetic_configure_lock;
 
         rs2_frame_callback_sptr _post_process_callback;
         std::shared_ptr<raw_sensor_base> _raw_sensor;
@@ -230,6 +230,7 @@ frame_interface * software_sensor::allocate_new_frame( rs2_extension extension,
     else
     {
         frame->set_stream( std::dynamic_pointer_cast< stream_profile_interface >( profile->shared_from_this() ) );
+        trace_frame( frame, RS2_FRAME_TRACE_STAGE_ARRIVAL );
     }
     return frame;
 }
@@ -8,6 +8,7 @@
 #include <src/core/enum-helpers.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 #include <src/core/stream-profile-interface.h>
 
 namespace librealsense
@@ -187,6 +188,40 @@ namespace librealsense
         }
     }
 
+    rsutils::json frame_source::get_telemetry() const
+    {
+        std::vector< std::pair< archive_id, std::shared_ptr< archive_interface > > > archives;
+        {
+            std::lock_guard< std::recursive_mutex > lock( _mutex );
+            archives.assign( _archive.begin(), _archive.end() );
+        }
+
+        // The counters are atomics: no need to hold up frame allocation while reading them
+        rsutils::json j = rsutils::json::array();
+        for( auto & a : archives )
+        {
+            if( ! a.second )
+                continue;
+            auto t = a.second->get_telemetry();
+            rsutils::json ja;
+            if( std::get< rs2_stream >( a.first ) != RS2_STREAM_COUNT )  // see add_extension
+            {
+                ja["stream"] = get_string( std::get< rs2_stream >( a.first ) );
+                ja["index"] = std::get< int >( a.first );
+            }
+            ja["frame-type"] = get_string( std::get< rs2_extension >( a.first ) );
+            ja["max-published"] = t.max_published;
+            ja["published"] = t.published;
+            ja["published-total"] = t.published_total;
+            ja["publish-failures"] = t.publish_failures;
+            ja["freelist-size"] = t.freelist_size;
+            ja["bytes-allocated"] = t.bytes_allocated;
+            ja["bytes-recycled"] = t.bytes_recycled;
+            j.push_back( std::move( ja ) );
+        }
+        return j;
+    }
+
         rs2_extension frame_source::stream_to_frame_types( rs2_stream stream )
     {
         // TODO: explicitly return video_frame for relevant streams and default to an error?
@@ -7,6 +7,8 @@
 #include <librealsense2/hpp/rs_types.hpp>
 #include <src/frame-archive.h>
 
+#include <rsutils/json-fwd.h>
+
 #include <tuple>
 
 namespace librealsense
@@ -42,6 +44,9 @@ namespace librealsense
 
         void flush() const;
 
+        // Frame memory counters of each archive (per stream and frame type), as a JSON array
+        rsutils::json get_telemetry() const;
+
         virtual ~frame_source() { flush(); }
 
         void set_sensor( const std::weak_ptr< sensor_interface > & s );
@@ -9,8 +9,10 @@
 #include "core/sensor-interface.h"
 #include "composite-frame.h"
 #include "core/time-service.h"
+#include "async-log.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 namespace librealsense
@@ -20,11 +22,134 @@ namespace librealsense
 #define LOG_IF_ENABLE( OSTREAM, ENV ) \
     while( ENV.log ) \
     { \
-        LOG_DEBUG( OSTREAM ); \
+        LOG_DEBUG_HOT( OSTREAM ); \
         break; \
     }
 
 
+    // Enough to cover the frames held by the matchers (a few queues deep); older entries were dropped
+    static const size_t MAX_PENDING_ARRIVALS = 4 * QUEUE_MAX_SIZE;
+
+    void sync_statistics::on_arrival( frame_interface const * f )
+    {
+        auto profile = f->get_stream();
+        auto const now = clock::now();
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto & stream = _streams[profile->get_unique_id()];
+        stream.type = profile->get_stream_type();
+        stream.index = profile->get_stream_index();
+        if( stream.pending.size() >= MAX_PENDING_ARRIVALS )
+        {
+            stream.pending.pop_front();
+            ++stream.dropped;
+        }
+        stream.pending.push_back( { f, f->get_frame_number(), now } );
+    }
+
+    void sync_statistics::on_release( frame_interface const * f )
+    {
+        auto const now = clock::now();
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( auto composite = dynamic_cast< composite_frame const * >( f ) )
+        {
+            for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+                on_release_single( composite->get_frame( int( i ) ), now );
+        }
+        else
+            on_release_single( f, now );
+    }
+
+    void sync_statistics::on_release_single( frame_interface const * f, clock::time_point now )
+    {
+        auto it = _streams.find( f->get_stream()->get_unique_id() );
+        if( it == _streams.end() )
+            return;
+        auto & stream = it->second;
+
+        // Frames of a stream leave in the order they arrived: anything that arrived before this one is gone
+        auto const number = f->get_frame_number();
+        size_t n_earlier = 0;
+        while( n_earlier < stream.pending.size()
+               && ( stream.pending[n_earlier].frame != f || stream.pending[n_earlier].number != number ) )
+            ++n_earlier;
+        if( n_earlier == stream.pending.size() )
+            return;  // Not seen arriving (e.g. the statistics were reset meanwhile)
+
+        stream.dropped += n_earlier;
+        auto const hold_us
+            = std::chrono::duration< double, std::micro >( now - stream.pending[n_earlier].time ).count();
+        stream.pending.erase( stream.pending.begin(), stream.pending.begin() + n_earlier + 1 );
+
+        ++stream.released;
+        stream.total_hold_us += hold_us;
+        stream.max_hold_us = std::max( stream.max_hold_us, hold_us );
+        size_t bucket = 0;
+        while( bucket + 1 < HISTOGRAM_BUCKETS && hold_us >= double( 1ull << bucket ) )
+            ++bucket;
+        ++stream.histogram[bucket];
+    }
+
+    void sync_statistics::on_release_decision( release_reason reason )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_releases[reason];
+    }
+
+    void sync_statistics::reset()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _streams.clear();
+        _releases = {};
+    }
+
+    rsutils::json sync_statistics::to_json() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        rsutils::json j;
+        j["releases"] = { { "complete", _releases[RELEASE_COMPLETE] },
+                          { "missing-inactive", _releases[RELEASE_MISSING_INACTIVE] },
+                          { "missing-skipped", _releases[RELEASE_MISSING_SKIPPED] },
+                          { "unsynced", _releases[RELEASE_UNSYNCED] } };
+
+        auto & bounds = j["histogram-bounds-us"] = rsutils::json::array();
+        for( size_t i = 0; i + 1 < HISTOGRAM_BUCKETS; ++i )
+            bounds.push_back( 1ull << i );
+
+        auto & streams = j["streams"] = rsutils::json::array();
+        for( auto & s : _streams )
+        {
+            auto & stream = s.second;
+            rsutils::json js;
+            js["id"] = s.first;
+            js["stream"] = rs2_stream_to_string( stream.type );
+            js["index"] = stream.index;
+            js["released"] = stream.released;
+            js["dropped"] = stream.dropped;
+            js["pending"] = stream.pending.size();
+            js["mean-hold-us"] = stream.released ? stream.total_hold_us / stream.released : 0.;
+            js["max-hold-us"] = stream.max_hold_us;
+            js["histogram"] = stream.histogram;
+            streams.push_back( std::move( js ) );
+        }
+        return j;
+    }
+
+    rsutils::json sync_statistics::get_pending() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        rsutils::json j = rsutils::json::array();
+        for( auto & s : _streams )
+            j.push_back( { { "id", s.first },
+                           { "stream", rs2_stream_to_string( s.second.type ) },
+                           { "index", s.second.index },
+                           { "pending", s.second.pending.size() } } );
+        return j;
+    }
+
     matcher::matcher(std::vector<stream_id> streams_id)
         : _streams_id(streams_id){}
 
@@ -125,52 +250,182 @@ namespace librealsense
         return s.str();
     }
 
+    void frame_ring::push( frame_holder && f, rs2_time_t arrival_time )
+    {
+        if( _size == _frames.size() )
+        {
+            // If queues are overrun, we'll get here
+            LOG_DEBUG_HOT( "DROPPED frame " << front() );
+            pop();
+        }
+        auto const tail = ( _head + _size ) % _frames.size();
+        _frames[tail] = std::move( f );
+        _arrival_times[tail] = arrival_time;
+        ++_size;
+    }
+
+    frame_holder frame_ring::pop()
+    {
+        frame_holder f = std::move( _frames[_head] );
+        _head = ( _head + 1 ) % _frames.size();
+        --_size;
+        return f;
+    }
+
+    void frame_ring::clear()
+    {
+        while( _size )
+            pop();
+        _head = 0;
+    }
+
     composite_matcher::composite_matcher(
         std::vector< std::shared_ptr< matcher > > const & matchers, std::string const & name )
     {
         for (auto&& matcher : matchers)
+            add_slot( matcher );
+
+        _name = create_composite_name(matchers, name);
+    }
+
+    size_t composite_matcher::add_slot( std::shared_ptr< matcher > const & m )
+    {
+        m->set_callback(
+            [&]( frame_holder f, const syncronization_environment & env ) {
+                LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
+                sync( std::move( f ), env );
+            } );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        size_t index;
+        if( _dead_slots.empty() )
         {
-            for (auto&& stream : matcher->get_streams())
+            index = _slots.size();
+            _slots.emplace_back();
+        }
+        else
+        {
+            index = _dead_slots.back();
+            _dead_slots.pop_back();
+            _slots[index] = matcher_slot();
+        }
+        _slots[index].m = m;
+
+        std::vector< size_t > replaced;
+        for( auto stream : m->get_streams() )
+        {
+            // A stream can only be handled by one matcher: a matcher replaced by a new one no longer takes part
+            auto it = _slot_by_stream.find( stream );
+            if( it != _slot_by_stream.end() )
             {
-                matcher->set_callback(
-                    [&]( frame_holder f, const syncronization_environment & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-                _matchers[stream] = matcher;
-                _streams_id.push_back(stream);
+                clear_slot( it->second );
+                _slots[it->second].queued = false;
+                replaced.push_back( it->second );
             }
-            for (auto&& stream : matcher->get_streams_types())
+            else
+                _streams_id.push_back( stream );
+            _slot_by_stream[stream] = index;
+        }
+        for( auto stream : m->get_streams_types() )
+            if( std::find( _streams_type.begin(), _streams_type.end(), stream ) == _streams_type.end() )
+                _streams_type.push_back( stream );
+
+        // A replaced matcher that no longer handles any stream is dropped, and its slot reused
+        for( auto i : replaced )
+        {
+            if( ! _slots[i].m )
+                continue;  // already dropped
+            bool const dead = std::none_of( _slot_by_stream.begin(),
+                                            _slot_by_stream.end(),
+                                            [i]( std::pair< const stream_id, size_t > const & p )
+                                            { return p.second == i; } );
+            if( dead )
             {
-                _streams_type.push_back(stream);
+                _slots[i].m.reset();
+                _dead_slots.push_back( i );
             }
         }
 
-        _name = create_composite_name(matchers, name);
+        return index;
+    }
+
+    void composite_matcher::clear_slot( size_t slot )
+    {
+        auto & s = _slots[slot];
+        if( s.queue.empty() )
+            return;
+        s.queue.clear();
+        _arrived.erase( std::find( _arrived.begin(), _arrived.end(), slot ) );
+        _decided = false;
     }
 
-    composite_matcher::matcher_queue::matcher_queue()
-        : q( QUEUE_MAX_SIZE,
-             []( frame_holder const & fh )
-             {
-                 // If queues are overrun, we'll get here
-                 LOG_DEBUG( "DROPPED frame " << fh );
-             } )
+    void composite_matcher::queue_frame( size_t slot, frame_holder && f )
     {
+        auto & s = _slots[slot];
+        s.queued = true;
+        bool const was_empty = s.queue.empty();
+        bool const drops_front = s.queue.full();
+        s.queue.push( std::move( f ), time_service::get_time() );
+        if( was_empty )
+        {
+            // A new front: we only need to compare it with the current candidate
+            _arrived.push_back( slot );
+            if( _decided )
+                add_to_decision( slot );
+        }
+        else if( drops_front )
+            _decided = false;
     }
 
+    frame_holder composite_matcher::release_front( size_t slot )
+    {
+        auto & s = _slots[slot];
+        auto f = s.queue.pop();
+        if( s.queue.empty() )
+            _arrived.erase( std::find( _arrived.begin(), _arrived.end(), slot ) );
+        _decided = false;
+        return f;
+    }
+
+    void composite_matcher::add_to_decision( size_t slot )
+    {
+        auto & candidate = _slots[slot].queue.front();
+        if( _synced.empty() )
+        {
+            _synced.push_back( slot );
+            return;
+        }
+        auto & curr_sync = _slots[_synced[0]].queue.front();
+        if( are_equivalent( curr_sync, candidate ) )
+        {
+            _synced.push_back( slot );
+        }
+        else if( is_smaller_than( candidate, curr_sync ) )
+        {
+            // Sometimes we have to release newly-arrived frames even before frames we already had previously
+            // queued. If we have something like this, '_unsynced' will not be empty
+            _unsynced.insert( _unsynced.end(), _synced.begin(), _synced.end() );
+            _synced.clear();
+            _synced.push_back( slot );
+        }
+        else
+        {
+            _unsynced.push_back( slot );
+        }
+    }
 
     void composite_matcher::dispatch(frame_holder f, const syncronization_environment& env)
     {
         clean_inactive_streams(f);
-        auto matcher = find_matcher(f);
+        auto slot = find_slot(f);
 
         //LOG_IF_ENABLE( "--> composite_matcher: " << _name, env );
 
-        if (matcher)
+        if( slot >= 0 )
         {
-            update_last_arrived(f, matcher.get());
-            matcher->dispatch(std::move(f), env);
+            update_last_arrived( f, slot );
+            _slots[slot].m->dispatch( std::move( f ), env );
         }
         else
         {
@@ -179,32 +434,35 @@ namespace librealsense
         }
     }
 
-    std::shared_ptr<matcher> composite_matcher::find_matcher(const frame_holder& frame)
+    std::shared_ptr< matcher > composite_matcher::find_matcher( const frame_holder & f )
+    {
+        auto slot = find_slot( f );
+        if( slot < 0 )
+            return {};
+        return _slots[slot].m;
+    }
+
+    int composite_matcher::find_slot( const frame_holder & frame )
     {
         auto stream_profile = frame.frame->get_stream();
         auto stream_id = stream_profile->get_unique_id();
         auto stream_type = stream_profile->get_stream_type();
 
-        std::shared_ptr<matcher> matcher;
-        auto it = _matchers.find( stream_id );
-        if( it != _matchers.end() )
+        auto it = _slot_by_stream.find( stream_id );
+        if( it != _slot_by_stream.end() )
         {
-            matcher = it->second;
-            if( matcher )
+            auto & slot = _slots[it->second];
+            if( ! slot.m->get_active() )
             {
-                if( ! matcher->get_active() )
-                {
-                    matcher->set_active( true );
-                    _frames_queue[matcher.get()].q.start();
-                }
-                return matcher;
+                slot.m->start();
+                slot.queued = true;
             }
+            return int( it->second );
         }
         LOG_DEBUG( "no matcher found for " << get_abbr_string( stream_type ) << stream_id
                                            << "; creating matcher from device..." );
 
         auto sensor = frame.frame->get_sensor().get(); //TODO: Potential deadlock if get_sensor() gets a hold of the last reference of that sensor
-        auto dev_exist = false;
         if (sensor)
         {
             const device_interface* dev = nullptr;
@@ -218,29 +476,10 @@ namespace librealsense
             }
             if (dev)
             {
-                dev_exist = true;
-                matcher = dev->create_matcher(frame);
+                auto matcher = dev->create_matcher(frame);
                 LOG_DEBUG( "... created " << matcher->get_name() );
 
-                matcher->set_callback(
-                    [&]( frame_holder f, syncronization_environment const & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-
-                for (auto stream : matcher->get_streams())
-                {
-                    if (_matchers[stream])
-                    {
-                        _frames_queue.erase(_matchers[stream].get());
-                    }
-                    _matchers[stream] = matcher;
-                    _streams_id.push_back(stream);
-                }
-                for (auto stream : matcher->get_streams_types())
-                {
-                    _streams_type.push_back(stream);
-                }
+                auto index = add_slot( matcher );
 
                 if (std::find(_streams_type.begin(), _streams_type.end(), stream_type) == _streams_type.end())
                 {
@@ -251,6 +490,11 @@ namespace librealsense
                     _name = create_composite_name( { matcher },
                                                     _name.substr( 1, _name.length() - 2 ) );  // Remove the "()" around "(CI: )"
                 }
+
+                it = _slot_by_stream.find( stream_id );
+                if( it != _slot_by_stream.end() )
+                    return int( it->second );
+                return int( index );
             }
         }
         else
@@ -258,25 +502,8 @@ namespace librealsense
             LOG_DEBUG("sensor does not exist");
         }
 
-        if (!dev_exist)
-        {
-            matcher = _matchers[stream_id];
-            // We don't know what device this frame came from, so just store it under device NULL with ID matcher
-            if (!matcher)
-            {
-                _matchers[stream_id] = std::make_shared<identity_matcher>(stream_id, stream_type);
-                _streams_id.push_back(stream_id);
-                _streams_type.push_back(stream_type);
-                matcher = _matchers[stream_id];
-
-                matcher->set_callback(
-                    [&]( frame_holder f, syncronization_environment const & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-            }
-        }
-        return matcher;
+        // We don't know what device this frame came from, so just store it under device NULL with ID matcher
+        return int( add_slot( std::make_shared< identity_matcher >( stream_id, stream_type ) ) );
     }
 
     void composite_matcher::stop()
@@ -286,14 +513,27 @@ namespace librealsense
 
         // Mark ourselves inactive, so we don't get new dispatches
         set_active( false );
+        _stopped = true;
 
-        // Stop all our queues to wake up anyone waiting on them
-        for( auto & fq : _frames_queue )
-            fq.second.q.stop();
+        for( auto & slot : _slots )
+        {
+            if( ! slot.m )
+                continue;
+            slot.queue.clear();
+            // Trickle the stop down to any children
+            slot.m->stop();
+        }
+        _arrived.clear();
+        _synced.clear();
+        _unsynced.clear();
+        _decided = true;
+    }
 
-        // Trickle the stop down to any children
-        for( auto m : _matchers )
-            m.second->stop();
+    void composite_matcher::start()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopped = false;
+        set_active( true );
     }
 
     std::string
@@ -305,154 +545,46 @@ namespace librealsense
         return os.str();
     }
 
-    std::string
-        composite_matcher::matchers_to_string( std::vector< librealsense::matcher* > const& matchers )
-    {
-        std::ostringstream os;
-        os << '[';
-        for( auto m : matchers )
-        {
-            auto const & q = _frames_queue[m].q;
-            q.peek( [&os]( frame_holder const & fh ) {
-                os << fh;
-                } );
-        }
-        os << ']';
-        return os.str();
-    }
-
     void composite_matcher::sync(frame_holder f, const syncronization_environment& env)
     {
-        auto matcher = find_matcher(f);
-        if (!matcher)
+        auto slot = find_slot(f);
+        if( slot < 0 )
         {
             LOG_ERROR("didn't find any matcher for " << f << " will not be synchronized");
             _callback(std::move(f), env);
             return;
         }
-        update_next_expected( matcher, f );
+        update_next_expected( slot, f );
 
         // We want to keep track of a "last-arrived" frame which is our current equivalent of "now" -- it contains the
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].q.enqueue( std::move( f ) ) )
-            // If we get stopped, nothing to do!
-            return;
-
         // We have a queue for each known stream we want to sync.
         // E.g., for (Depth Color), we need to sync two frames, one from each.
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
+        // We don't want to stop while syncing!
+        std::unique_lock< std::mutex > lock( _mutex );
+        // If we get stopped, nothing to do!
+        if( _stopped )
+            return;
+        queue_frame( slot, std::move( f ) );
 
         while( true )
         {
-            missing_streams.clear();
-            frames_arrived_matchers.clear();
-            frames_arrived.clear();
+            sync_statistics::release_reason reason;
+            if( ! decide( last_arrived, env, reason ) )
+                break;
+            if( env.stats )
+                env.stats->on_release_decision( reason );
 
             std::vector< frame_holder > match;
-            {
-                // We don't want to stop while syncing!
-                std::lock_guard< std::mutex > lock( _mutex );
-
-                // We want to release one frame from each matcher. If a matcher has nothing queued, it is "missing" and
-                // we need to consider waiting for it:
-                for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
-                {
-                    librealsense::matcher * const m = s->first;
-                    if( ! s->second.q.peek( [&]( frame_holder & fh ) {
-                            LOG_IF_ENABLE( "... have " << *fh.frame, env );
-                            frames_arrived.push_back( &fh );
-                            frames_arrived_matchers.push_back( m );
-                        } ) )
-                    {
-                        missing_streams.push_back( m );
-                    }
-                }
-                if( frames_arrived.empty() )
-                {
-                    // LOG_IF_ENABLE( "... nothing more to do", env );
-                    break;
-                }
-
-                // From what we collected, we want to release only the frames that are synchronized (based on timestamp,
-                // number, etc.) -- anything else we'll leave to the next iteration. The synced frames should be the
-                // earliest possible!
-
-                frame_holder * curr_sync = frames_arrived[0];
-                synced_frames.clear();
-                synced_frames.push_back( 0 );
-
-                // Sometimes we have to release newly-arrived frames even before frames we already had previously
-                // queued. If we have something like this, 'have_unsynced_frames' will be true:
-                unsynced_frames.clear();
-                for( auto i = 1; i < frames_arrived.size(); i++ )
-                {
-                    if( are_equivalent( *curr_sync, *frames_arrived[i] ) )
-                    {
-                        synced_frames.push_back( i );
-                    }
-                    else if( is_smaller_than( *frames_arrived[i], *curr_sync ) )
-                    {
-                        unsynced_frames.insert( unsynced_frames.end(), synced_frames.begin(), synced_frames.end() );
-                        synced_frames.clear();
-                        synced_frames.push_back( i );
-                        curr_sync = frames_arrived[i];
-                    }
-                    else
-                    {
-                        unsynced_frames.push_back( i );
-                    }
-                }
-                bool release_synced_frames = ( synced_frames.size() != 0 );
-                if( unsynced_frames.empty() )
-                {
-                    // Everything (could be only one!) matches together... but if we also have
-                    // something missing, we can't release anything yet...
-                    for( auto i : missing_streams )
-                    {
-                        LOG_IF_ENABLE( "... missing " << i->get_name() << ", next expected @"
-                                                      << rsutils::string::from( _next_expected[i].value ) << " (from "
-                                                      << rsutils::string::from( _next_expected[i].fps ) << " fps)",
-                                       env );
-                        if( skip_missing_stream( *curr_sync, i, last_arrived, env ) )
-                        {
-                            LOG_IF_ENABLE( "...     cannot be synced; not waiting for it", env );
-                            continue;
-                        }
-
-                        LOG_IF_ENABLE( "...     waiting for it", env );
-                        release_synced_frames = false;
-                    }
-                }
-                else
-                {
-                    for( auto i : unsynced_frames )
-                    {
-                        LOG_IF_ENABLE( "  - " << *frames_arrived[i]->frame << " is not in sync; won't be released", env );
-                    }
-                }
-                if( ! release_synced_frames )
-                    break;
-
-                match.reserve( synced_frames.size() );
-
-                for( auto index : synced_frames )
-                {
-                    frame_holder frame;
-                    int const timeout_ms = 5000;
-                    librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].q.dequeue( &frame, timeout_ms );
-                    match.push_back( std::move( frame ) );
-                }
-            }
+            match.reserve( _synced.size() );
+            for( auto i : _synced )
+                match.push_back( release_front( i ) );
+            lock.unlock();
 
             // The frameset should always be with the same order of streams (the first stream carries extra
             // meaning because it decides the frameset properties) -- so we sort them...
@@ -470,7 +602,74 @@ namespace librealsense
                 auto cb = begin_callback();
                 _callback(std::move(composite), env);
             }
+
+            lock.lock();
+            if( _stopped )
+                break;
+        }
+    }
+
+    bool composite_matcher::decide( const frame_header & last_arrived,
+                                    const syncronization_environment & env,
+                                    sync_statistics::release_reason & reason )
+    {
+        // We want to release one frame from each matcher. From what we have, we want to release only the frames that
+        // are synchronized (based on timestamp, number, etc.) -- anything else we'll leave to the next iteration. The
+        // synced frames should be the earliest possible!
+        if( _arrived.empty() )
+        {
+            // LOG_IF_ENABLE( "... nothing more to do", env );
+            return false;
+        }
+        if( ! _decided )
+        {
+            _synced.clear();
+            _unsynced.clear();
+            for( auto i : _arrived )
+                add_to_decision( i );
+            _decided = true;
+        }
+        for( auto i : _arrived )
+            LOG_IF_ENABLE( "... have " << *_slots[i].queue.front().frame, env );
+
+        if( ! _unsynced.empty() )
+        {
+            for( auto i : _unsynced )
+                LOG_IF_ENABLE( "  - " << *_slots[i].queue.front().frame << " is not in sync; won't be released", env );
+            reason = sync_statistics::RELEASE_UNSYNCED;
+            return true;
+        }
+
+        // Everything (could be only one!) matches together... but if we also have something missing (a matcher with
+        // nothing queued), we need to consider waiting for it
+        reason = sync_statistics::RELEASE_COMPLETE;
+        auto const curr_sync = _slots[_synced[0]].queue.front().frame;
+        _missing.clear();
+        for( size_t i = 0; i < _slots.size(); ++i )
+            if( _slots[i].queued && _slots[i].queue.empty() && _slots[i].m )
+                _missing.push_back( i );
+        bool release_synced_frames = true;
+        for( auto i : _missing )
+        {
+            LOG_IF_ENABLE( "... missing " << _slots[i].m->get_name() << ", next expected @"
+                                          << rsutils::string::from( _slots[i].next_expected.value )
+                                          << " (from " << rsutils::string::from( _slots[i].next_expected.fps )
+                                          << " fps)",
+                           env );
+            if( skip_missing_stream( curr_sync, i, last_arrived, env ) )
+            {
+                LOG_IF_ENABLE( "...     cannot be synced; not waiting for it", env );
+                if( ! _slots[i].m->get_active() )
+                    reason = sync_statistics::RELEASE_MISSING_INACTIVE;
+                else if( reason == sync_statistics::RELEASE_COMPLETE )
+                    reason = sync_statistics::RELEASE_MISSING_SKIPPED;
+                continue;
+            }
+
+            LOG_IF_ENABLE( "...     waiting for it", env );
+            release_synced_frames = false;
         }
+        return release_synced_frames;
     }
 
     frame_number_composite_matcher::frame_number_composite_matcher(
@@ -479,9 +678,9 @@ namespace librealsense
     {
     }
 
-    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, size_t slot)
     {
-        _last_arrived[m] =f->get_frame_number();
+        _slots[slot].last_arrived = double( f->get_frame_number() );
     }
 
     bool frame_number_composite_matcher::are_equivalent(frame_holder& a, frame_holder& b)
@@ -494,41 +693,38 @@ namespace librealsense
     }
     void frame_number_composite_matcher::clean_inactive_streams(frame_holder& f)
     {
-        std::vector<stream_id> inactive_matchers;
-        for(auto m: _matchers)
+        for( size_t i = 0; i < _slots.size(); ++i )
         {
-            if( _last_arrived[m.second.get()]
-                && ( std::abs( (long long)f->get_frame_number() - (long long)_last_arrived[m.second.get()] ) ) > 5 )
+            auto & slot = _slots[i];
+            if( slot.m && slot.last_arrived
+                && std::abs( (long long)f->get_frame_number() - (long long)slot.last_arrived ) > 5 )
             {
                 std::stringstream s;
                 s << "clean inactive stream in "<<_name;
-                for (auto stream : m.second->get_streams_types())
+                for (auto stream : slot.m->get_streams_types())
                 {
                     s << stream << " ";
                 }
                 LOG_DEBUG(s.str());
 
-                inactive_matchers.push_back(m.first);
-                m.second->set_active(false);
+                slot.m->set_active(false);
+                std::lock_guard< std::mutex > lock( _mutex );
+                clear_slot( i );
+                slot.queued = true;
             }
         }
-
-        for(auto id: inactive_matchers)
-        {
-            _frames_queue[_matchers[id].get()].q.clear();
-        }
     }
 
     bool
     frame_number_composite_matcher::skip_missing_stream( frame_interface const * const synced_frame,
-                                                         matcher * missing,
+                                                         size_t missing,
                                                          frame_header const & last_arrived,
                                                          const syncronization_environment & env )
     {
-         if(!missing->get_active())
+         if(!_slots[missing].m->get_active())
              return true;
 
-        auto const & next_expected = _next_expected[missing];
+        auto const & next_expected = _slots[missing].next_expected;
 
         if( synced_frame->get_frame_number() - next_expected.value > 4
             || synced_frame->get_frame_number() < next_expected.value )
@@ -538,10 +734,9 @@ namespace librealsense
         return false;
     }
 
-    void frame_number_composite_matcher::update_next_expected(
-        std::shared_ptr< matcher > const & matcher, const frame_holder & f )
+    void frame_number_composite_matcher::update_next_expected( size_t slot, const frame_holder & f )
     {
-        _next_expected[matcher.get()].value = f.frame->get_frame_number()+1.;
+        _slots[slot].next_expected.value = f.frame->get_frame_number()+1.;
     }
 
     std::pair<double, double> extract_timestamps(frame_holder & a, frame_holder & b)
@@ -553,8 +748,8 @@ namespace librealsense
     }
 
     timestamp_composite_matcher::timestamp_composite_matcher(
-        std::vector< std::shared_ptr< matcher > > const & matchers )
-        : composite_matcher( matchers, "TS: " )
+        std::vector< std::shared_ptr< matcher > > const & matchers, std::string const & name )
+        : composite_matcher( matchers, name )
     {
     }
     bool timestamp_composite_matcher::are_equivalent(frame_holder & a, frame_holder & b)
@@ -581,11 +776,11 @@ namespace librealsense
         return ts.first < ts.second;
     }
 
-    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, size_t slot)
     {
         auto const now = time_service::get_time();
-        //LOG_DEBUG( _name << ": _last_arrived[" << m->get_name() << "] = " << now );
-        _last_arrived[m] = now;
+        //LOG_DEBUG( _name << ": last_arrived[" << _slots[slot].m->get_name() << "] = " << now );
+        _slots[slot].last_arrived = now;
     }
 
     double timestamp_composite_matcher::get_fps( frame_interface const * f )
@@ -607,8 +802,7 @@ namespace librealsense
     }
 
     void
-    timestamp_composite_matcher::update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                                       const frame_holder & f )
+    timestamp_composite_matcher::update_next_expected( size_t slot, const frame_holder & f )
     {
         auto fps = get_fps( f );
         auto gap = 1000. / fps;
@@ -618,7 +812,7 @@ namespace librealsense
         //LOG_DEBUG( "... next_expected = {timestamp}" << rsutils::string::from( ts ) << " + {gap}(1000/{fps}"
         //                                             << rsutils::string::from( fps )
         //                                             << ") = " << rsutils::string::from( ne ) );
-        auto & next_expected = _next_expected[matcher.get()];
+        auto & next_expected = _slots[slot].next_expected;
         next_expected.value = ne;
         next_expected.fps = fps;
         next_expected.domain = f.frame->get_frame_timestamp_domain();
@@ -630,19 +824,20 @@ namespace librealsense
     }
 
     bool timestamp_composite_matcher::skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                                           matcher * missing,
+                                                           size_t missing,
                                                            frame_header const & last_arrived,
                                                            const syncronization_environment & env )
     {
         // true : frameset is ready despite the missing stream (no use waiting) -- "skip" it
         // false: the missing stream is relevant and our frameset isn't ready yet!
 
-        if(!missing->get_active())
+        auto & slot = _slots[missing];
+        if(!slot.m->get_active())
             return true;
 
         //LOG_IF_ENABLE( "...     matcher " << synced[0]->get_name(), env );
 
-        auto const & next_expected = _next_expected[missing];
+        auto const & next_expected = slot.next_expected;
         // LOG_IF_ENABLE( "...     next    " << std::fixed << next_expected, env );
 
         if( next_expected.domain != last_arrived.timestamp_domain )
@@ -717,13 +912,9 @@ namespace librealsense
                                << rsutils::string::from( next_expected.value + threshold ) << "; deactivating matcher!",
                            env );
 
-            auto const q_it = _frames_queue.find( missing );
-            if( q_it != _frames_queue.end() )
-            {
-                if( q_it->second.q.empty() )
-                    _frames_queue.erase( q_it );
-            }
-            missing->set_active( false );
+            if( slot.queue.empty() )
+                slot.queued = false;
+            slot.m->set_active( false );
             return true;
         }
 
@@ -748,6 +939,49 @@ namespace librealsense
         return false;
     }
 
+    multi_device_composite_matcher::multi_device_composite_matcher( double tolerance, double max_wait )
+        : timestamp_composite_matcher( {}, "MD: " )
+        , _tolerance( tolerance )
+        , _max_wait( max_wait )
+    {
+        if( tolerance < 0 || max_wait < 0 )
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "invalid multi-device sync tolerance (" << tolerance
+                                           << ") or maximum wait (" << max_wait << ")" );
+    }
+
+    bool multi_device_composite_matcher::are_equivalent( double a, double b, double fps )
+    {
+        if( ! _tolerance )
+            return timestamp_composite_matcher::are_equivalent( a, b, fps );
+        return std::abs( a - b ) <= _tolerance;
+    }
+
+    bool multi_device_composite_matcher::skip_missing_stream( frame_interface const * waiting_to_be_released,
+                                                              size_t missing,
+                                                              frame_header const & last_arrived,
+                                                              const syncronization_environment & env )
+    {
+        if( _max_wait )
+        {
+            // The frames waiting to be released are at the front of their queues
+            for( auto & slot : _slots )
+            {
+                if( slot.queue.empty() || slot.queue.front().frame != waiting_to_be_released )
+                    continue;
+                auto const waited = time_service::get_time() - slot.queue.front_arrival_time();
+                if( waited > _max_wait )
+                {
+                    LOG_IF_ENABLE( "...     waited " << rsutils::string::from( waited ) << " ms; not waiting any longer",
+                                   env );
+                    return true;
+                }
+                break;
+            }
+        }
+        return timestamp_composite_matcher::skip_missing_stream( waiting_to_be_released, missing, last_arrived, env );
+    }
+
     composite_identity_matcher::composite_identity_matcher(
         std::vector< std::shared_ptr< matcher > > const & matchers )
         : composite_matcher( matchers, "CI: " )
@@ -7,11 +7,17 @@
 
 #include <librealsense2/h/rs_sensor.h>
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/json-fwd.h>
 #include <stdint.h>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <deque>
+#include <atomic>
+#include <unordered_map>
 #include <map>
+#include <array>
+#include <chrono>
 
 
 namespace librealsense {
@@ -19,22 +25,84 @@ namespace librealsense {
 
     class synthetic_source_interface;
 
+    typedef int stream_id;
+
+    // Latency accounting of a syncer: how long each frame was held waiting for its partners, how many frames never
+    // made it out, and why the matchers released what they did. Shared by all the matchers the syncer drives.
+    class sync_statistics
+    {
+    public:
+        enum release_reason
+        {
+            RELEASE_COMPLETE,          // Nothing was missing
+            RELEASE_MISSING_INACTIVE,  // A missing stream was skipped because it is no longer active
+            RELEASE_MISSING_SKIPPED,   // A missing stream was skipped because its next frame cannot match
+            RELEASE_UNSYNCED,          // Released ahead of other queued frames that do not match it
+            RELEASE_REASON_COUNT
+        };
+
+        // Hold times are kept in power-of-two buckets of microseconds; the last bucket is open-ended
+        static const size_t HISTOGRAM_BUCKETS = 24;
+
+        // A frame enters the syncer
+        void on_arrival( frame_interface const * f );
+        // A frame (or frameset) leaves the syncer
+        void on_release( frame_interface const * f );
+        void on_release_decision( release_reason reason );
+
+        rsutils::json to_json() const;
+        void reset();
+
+        // Frames that arrived and were not released yet, per stream, as a JSON array
+        rsutils::json get_pending() const;
+
+    private:
+        typedef std::chrono::steady_clock clock;
+
+        struct arrival
+        {
+            frame_interface const * frame;
+            unsigned long long number;
+            clock::time_point time;
+        };
+
+        struct stream_statistics
+        {
+            rs2_stream type = RS2_STREAM_ANY;
+            int index = 0;
+            std::deque< arrival > pending;  // In arrival order, which is also release order
+            uint64_t released = 0;
+            uint64_t dropped = 0;
+            double total_hold_us = 0;
+            double max_hold_us = 0;
+            std::array< uint64_t, HISTOGRAM_BUCKETS > histogram = {};
+        };
+
+        void on_release_single( frame_interface const * f, clock::time_point now );
+
+        std::map< stream_id, stream_statistics > _streams;
+        std::array< uint64_t, RELEASE_REASON_COUNT > _releases = {};
+        mutable std::mutex _mutex;
+    };
+
     struct syncronization_environment
     {
         syncronization_environment( synthetic_source_interface * source,
                                     single_consumer_frame_queue< frame_holder >& matches,
-                                    bool log )
+                                    bool log,
+                                    sync_statistics * stats = nullptr )
             : source( source )
             , matches( matches )
             , log( log )
+            , stats( stats )
         {
         }
         synthetic_source_interface * source;
         single_consumer_frame_queue< frame_holder > & matches;
         bool log = true;
+        sync_statistics * stats = nullptr;
     };
 
-    typedef int stream_id;
     typedef std::function<void(frame_holder, const syncronization_environment&)> sync_callback;
 
     class matcher_interface
@@ -65,6 +133,8 @@ namespace librealsense {
         bool get_active() const;
         void set_active(const bool active);
         virtual void stop() override {}
+        // Undoes stop(): called when a stopped matcher gets frames again
+        virtual void start() { set_active( true ); }
 
     protected:
        std::vector<stream_id> _streams_id;
@@ -84,6 +154,36 @@ namespace librealsense {
 
     };
 
+    // Fixed-capacity FIFO of frames: when full, the oldest frame is dropped to make room
+    class frame_ring
+    {
+    public:
+        frame_ring( size_t capacity = QUEUE_MAX_SIZE )
+            : _frames( capacity )
+            , _arrival_times( capacity )
+        {
+        }
+
+        bool empty() const { return ! _size; }
+        size_t size() const { return _size; }
+        frame_holder & front() { return _frames[_head]; }
+        frame_holder const & front() const { return _frames[_head]; }
+        // Host time at which the front frame was queued
+        rs2_time_t front_arrival_time() const { return _arrival_times[_head]; }
+
+        bool full() const { return _size == _frames.size(); }
+
+        void push( frame_holder && f, rs2_time_t arrival_time );
+        frame_holder pop();
+        void clear();
+
+    private:
+        std::vector< frame_holder > _frames;
+        std::vector< rs2_time_t > _arrival_times;
+        size_t _head = 0;
+        size_t _size = 0;
+    };
+
     class composite_matcher : public matcher
     {
     public:
@@ -93,43 +193,73 @@ namespace librealsense {
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) = 0;
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) = 0;
         virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
+                                          size_t missing,
                                           frame_header const & last_arrived,
                                           const syncronization_environment & env )
             = 0;
         virtual void clean_inactive_streams(frame_holder& f) = 0;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) = 0;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) = 0;
 
         void dispatch(frame_holder f, const syncronization_environment& env) override;
         void sync(frame_holder f, const syncronization_environment& env) override;
         std::shared_ptr<matcher> find_matcher(const frame_holder& f);
         virtual void stop() override;
+        virtual void start() override;
 
         static std::string frames_to_string( std::vector< frame_holder* > const& );
-        std::string matchers_to_string( std::vector< matcher* > const& );
 
     protected:
-        virtual void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                           const frame_holder & f )
-            = 0;
-
-        struct matcher_queue
-        {
-            single_consumer_frame_queue< frame_holder > q;
-
-            matcher_queue();
-        };
+        virtual void update_next_expected( size_t slot, const frame_holder & f ) = 0;
 
-        std::map< matcher *, matcher_queue > _frames_queue;
-        std::map<stream_id, std::shared_ptr<matcher>> _matchers;
         struct next_expected_t
         {
             double value;  // timestamp/frame-number/etc.
             double fps;
             rs2_timestamp_domain domain;
         };
-        std::map< matcher *, next_expected_t > _next_expected;
 
+        // Everything we track for one child matcher. A slot index is a stable handle that the sync loop and the derived
+        // matchers use instead of looking the matcher up; the slot of a matcher that was replaced for all its streams
+        // is dead (no matcher) and reused by the next matcher added.
+        struct matcher_slot
+        {
+            std::shared_ptr< matcher > m;
+            frame_ring queue;
+            bool queued = false;  // Whether the matcher takes part in syncing, i.e. it can be "missing"
+            next_expected_t next_expected = {};
+            double last_arrived = 0;  // timestamp/frame-number/etc.
+        };
+
+        // Returns the slot of the matcher handling the frame's stream, creating a matcher if needed; -1 if none
+        int find_slot( const frame_holder & f );
+        size_t add_slot( std::shared_ptr< matcher > const & m );
+
+        // All below require _mutex to be held
+        void clear_slot( size_t slot );
+
+        std::deque< matcher_slot > _slots;
+        std::unordered_map< stream_id, size_t > _slot_by_stream;
+        std::vector< size_t > _dead_slots;
+        std::atomic< bool > _stopped{ false };
+
+    private:
+        void queue_frame( size_t slot, frame_holder && f );
+        frame_holder release_front( size_t slot );
+        void add_to_decision( size_t slot );
+        bool decide( const frame_header & last_arrived,
+                     const syncronization_environment & env,
+                     sync_statistics::release_reason & reason );
+
+        // The sync decision is kept as frames arrive: a frame arriving at an empty queue is compared against the
+        // current candidate only; the decision is recomputed from the queue fronts only once they change otherwise,
+        // i.e. after a release or a queue is cleared
+        std::vector< size_t > _arrived;   // Slots with frames queued, in the order their fronts were added
+        std::vector< size_t > _synced;    // Of _arrived, the fronts to be released together; [0] is the candidate
+        std::vector< size_t > _unsynced;  // Of _arrived, the fronts that aren't in sync with it
+        bool _decided = true;             // Whether _synced/_unsynced are up to date with _arrived
+        std::vector< size_t > _missing;   // Scratch space for decide()
+
+    protected:
         std::mutex _mutex;
     };
 
@@ -143,18 +273,17 @@ namespace librealsense {
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
+                                          size_t missing,
                                           frame_header const & last_arrived,
                                           const syncronization_environment & env ) override
         {
             return false;
         }
         virtual void clean_inactive_streams(frame_holder& f) override {}
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override {}
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override {}
 
     protected:
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override
+        void update_next_expected( size_t slot, const frame_holder & f ) override
         {
         }
     };
@@ -164,40 +293,60 @@ namespace librealsense {
     public:
         frame_number_composite_matcher(
             std::vector< std::shared_ptr< matcher > > const & matchers );
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override;
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  size_t missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
         void clean_inactive_streams(frame_holder& f) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
-
-    private:
-         std::map<matcher*,unsigned long long> _last_arrived;
+        void update_next_expected( size_t slot, const frame_holder & f ) override;
     };
 
     class timestamp_composite_matcher : public composite_matcher
     {
     public:
-        timestamp_composite_matcher( std::vector< std::shared_ptr< matcher > > const & matchers );
+        timestamp_composite_matcher( std::vector< std::shared_ptr< matcher > > const & matchers,
+                                     std::string const & name = "TS: " );
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, size_t slot) override;
         void clean_inactive_streams(frame_holder& f) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  size_t missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
+        void update_next_expected( size_t slot, const frame_holder & f ) override;
 
-    private:
+    protected:
         double get_fps( frame_interface const * f );
-        bool are_equivalent( double a, double b, double fps );
-        std::map<matcher*, double> _last_arrived;
+        virtual bool are_equivalent( double a, double b, double fps );
+    };
+
+    // Groups the framesets of several devices, e.g. a rig of hardware-synced cameras, into one frameset by timestamp.
+    // The devices must share a time domain, i.e. global time (see global_timestamp_reader) or the host clock; each
+    // device still syncs its own streams with its own matcher first.
+    class multi_device_composite_matcher : public timestamp_composite_matcher
+    {
+    public:
+        // tolerance: the maximum timestamp difference, in ms, of frames in one frameset (0 for half a frame period)
+        // max_wait: the maximum time, in ms, a frameset is held waiting for a missing device (0 for no bound); this is
+        //     checked whenever a frame arrives
+        multi_device_composite_matcher( double tolerance, double max_wait );
+
+        using timestamp_composite_matcher::are_equivalent;
+        bool skip_missing_stream( frame_interface const * waiting_to_be_released,
+                                  size_t missing,
+                                  frame_header const & last_arrived,
+                                  const syncronization_environment & env ) override;
+
+    protected:
+        bool are_equivalent( double a, double b, double fps ) override;
+
+    private:
+        double _tolerance;
+        double _max_wait;
     };
 
 
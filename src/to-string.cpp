@@ -459,6 +459,12 @@ std::string const & get_string_( rs2_option value )
         CASE( OHM_TEMPERATURE )
         CASE( SOC_PVT_TEMPERATURE )
         CASE( GYRO_SENSITIVITY )
+        CASE( FILTER_ROI_MIN_X )
+        CASE( FILTER_ROI_MIN_Y )
+        CASE( FILTER_ROI_MAX_X )
+        CASE( FILTER_ROI_MAX_Y )
+        CASE( FILTER_ROI_HALO )
+        CASE( RESULT_CACHE_SIZE )
 #undef CASE
         return arr;
     }();
@@ -528,6 +534,7 @@ const char * get_string( rs2_format value )
     CASE( MOTION_RAW )
     CASE( MOTION_XYZ32F )
     CASE( COMBINED_MOTION )
+    CASE( Z16RVL )
     CASE( GPIO_RAW )
     CASE( 6DOF )
     CASE( Y10BPACK )
@@ -667,6 +674,26 @@ const char * get_string( rs2_timestamp_domain value )
 #undef CASE
 }
 
+const char * get_string( rs2_frame_trace_stage value )
+{
+#define CASE( X ) STRCASE( FRAME_TRACE_STAGE, X )
+    switch( value )
+    {
+    CASE( ARRIVAL )
+    CASE( CONVERSION_START )
+    CASE( CONVERSION_END )
+    CASE( SYNC_START )
+    CASE( SYNC_END )
+    CASE( PROCESSING_START )
+    CASE( PROCESSING_END )
+    CASE( DELIVERY )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_calib_target_type value )
 {
 #define CASE( X ) STRCASE( CALIB_TARGET, X )
@@ -782,6 +809,7 @@ rs2_option rs2_option_from_string( char const * option_name )
 const char * rs2_option_type_to_string( rs2_option_type type ) { return librealsense::get_string( type ).c_str(); }
 const char * rs2_camera_info_to_string( rs2_camera_info info ) { return librealsense::get_string( info ); }
 const char * rs2_timestamp_domain_to_string( rs2_timestamp_domain info ) { return librealsense::get_string( info ); }
+const char * rs2_frame_trace_stage_to_string( rs2_frame_trace_stage stage ) { return librealsense::get_string( stage ); }
 const char * rs2_notification_category_to_string( rs2_notification_category category ) { return librealsense::get_string( category ); }
 const char * rs2_calib_target_type_to_string( rs2_calib_target_type type ) { return librealsense::get_string( type ); }
 const char * rs2_sr300_visual_preset_to_string( rs2_sr300_visual_preset preset ) { return librealsense::get_string( preset ); }
@@ -0,0 +1,320 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "tracing.h"
+#include "librealsense-exception.h"
+#include "log.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+
+namespace librealsense {
+namespace tracing {
+
+
+namespace detail {
+std::atomic< bool > active( false );
+}
+
+
+namespace {
+
+
+// Spans a thread recorded that were not written yet; a thread that records faster than the writer keeps up drops the
+// excess rather than growing without bound
+constexpr size_t MAX_PENDING_SPANS_PER_THREAD = 1 << 18;
+constexpr auto WRITE_INTERVAL = std::chrono::milliseconds( 500 );
+
+
+struct span_event
+{
+    const char * name;
+    int64_t start_us;
+    int64_t duration_us;
+};
+
+
+// Shared with the writer thread, so that a writer left behind on unload never touches a destroyed tracer
+struct writer_state
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+};
+
+
+// Escapes a span name for a JSON string
+void write_json_string( std::ostream & os, const char * str )
+{
+    static char const hex[] = "0123456789abcdef";
+    os << '"';
+    for( ; *str; ++str )
+    {
+        auto ch = static_cast< unsigned char >( *str );
+        switch( ch )
+        {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\r': os << "\\r"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if( ch < 0x20 )
+                os << "\\u00" << hex[ch >> 4] << hex[ch & 0xf];
+            else
+                os << *str;
+        }
+    }
+    os << '"';
+}
+
+
+struct thread_buffer
+{
+    std::mutex mutex;
+    std::vector< span_event > events;
+    size_t dropped = 0;
+    int tid;
+
+    explicit thread_buffer( int tid )
+        : tid( tid )
+    {
+    }
+};
+
+
+class tracer
+{
+public:
+    static tracer & instance()
+    {
+        static tracer the_tracer;
+        return the_tracer;
+    }
+
+    void start( std::string const & filename )
+    {
+        std::lock_guard< std::mutex > lock( _control_mutex );
+        unsafe_stop();
+
+        _file.open( filename, std::ios::out | std::ios::trunc );
+        if( ! _file )
+            throw invalid_value_exception( "failed to open trace file " + filename );
+        _file << "[";
+        _first_event = true;
+        detail::active = true;
+        auto state = std::make_shared< writer_state >();
+        _writer_state = state;
+        _writer = std::thread( [this, state]() { write_loop( *state ); } );
+    }
+
+    void stop()
+    {
+        std::lock_guard< std::mutex > lock( _control_mutex );
+        unsafe_stop();
+    }
+
+    void record( span_event const & e )
+    {
+        auto & buffer = get_thread_buffer();
+        std::lock_guard< std::mutex > lock( buffer.mutex );
+        if( buffer.events.size() < MAX_PENDING_SPANS_PER_THREAD )
+            buffer.events.push_back( e );
+        else
+            ++buffer.dropped;
+    }
+
+    const char * intern( std::string const & name )
+    {
+        std::lock_guard< std::mutex > lock( _buffers_mutex );
+        return _names.insert( name ).first->c_str();
+    }
+
+private:
+    tracer() = default;
+
+    ~tracer()
+    {
+        // We may be unloading, with the loader lock held: joining the writer could deadlock
+        try
+        {
+            std::lock_guard< std::mutex > lock( _control_mutex );
+            unsafe_stop( false );
+        }
+        catch( ... )
+        {
+        }
+    }
+
+    thread_buffer & get_thread_buffer()
+    {
+        // The buffer outlives the thread, so that spans of a thread that exited still get written
+        thread_local std::shared_ptr< thread_buffer > buffer;
+        if( ! buffer )
+        {
+            std::lock_guard< std::mutex > lock( _buffers_mutex );
+            buffer = std::make_shared< thread_buffer >( int( _buffers.size() + 1 ) );
+            _buffers.push_back( buffer );
+        }
+        return *buffer;
+    }
+
+    // Once stopping is set, the writer no longer writes: it only holds on to its state until it exits, so it can be
+    // left to do so on its own
+    void unsafe_stop( bool join = true )
+    {
+        if( ! _writer.joinable() )
+            return;
+
+        detail::active = false;
+        {
+            std::lock_guard< std::mutex > lock( _writer_state->mutex );
+            _writer_state->stopping = true;
+        }
+        _writer_state->cv.notify_one();
+        if( join )
+            _writer.join();
+        else
+            _writer.detach();
+        _writer_state.reset();
+
+        write_pending();
+        _file << "\n]\n";
+        _file.close();
+    }
+
+    void write_loop( writer_state & state )
+    {
+        // Pending spans are written with the lock held, so none are once stopping is set
+        std::unique_lock< std::mutex > lock( state.mutex );
+        while( ! state.stopping )
+        {
+            state.cv.wait_for( lock, WRITE_INTERVAL, [&state]() { return state.stopping; } );
+            if( ! state.stopping )
+                write_pending();
+        }
+    }
+
+    void write_pending()
+    {
+        std::vector< std::shared_ptr< thread_buffer > > buffers;
+        {
+            std::lock_guard< std::mutex > lock( _buffers_mutex );
+            buffers = _buffers;
+        }
+
+        for( auto & buffer : buffers )
+        {
+            size_t dropped;
+            {
+                std::lock_guard< std::mutex > lock( buffer->mutex );
+                _pending.swap( buffer->events );
+                dropped = buffer->dropped;
+                buffer->dropped = 0;
+            }
+
+            for( auto & e : _pending )
+            {
+                _file << ( _first_event ? "\n" : ",\n" ) << "{\"name\":";
+                write_json_string( _file, e.name );
+                _file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":" << e.start_us
+                      << ",\"dur\":" << e.duration_us << "}";
+                _first_event = false;
+            }
+            _pending.clear();
+
+            if( dropped )
+                LOG_WARNING( "Trace dropped " << dropped << " spans of thread " << buffer->tid );
+        }
+        _file.flush();
+    }
+
+    std::mutex _control_mutex;  // start/stop
+
+    std::mutex _buffers_mutex;
+    std::vector< std::shared_ptr< thread_buffer > > _buffers;
+    std::unordered_set< std::string > _names;
+
+    std::thread _writer;
+    std::shared_ptr< writer_state > _writer_state;
+
+    // Only touched by the writer thread, or by stop() once the writer is done
+    std::ofstream _file;
+    bool _first_event = true;
+    std::vector< span_event > _pending;
+};
+
+
+}  // namespace
+
+
+void start_from_environment()
+{
+    // A trace requested through the environment lasts until the library is unloaded
+    static std::once_flag once;
+    std::call_once( once,
+                    []()
+                    {
+                        auto filename = getenv( "LRS_TRACE_FILE" );
+                        if( ! filename || ! *filename || is_active() )
+                            return;
+                        try
+                        {
+                            start( filename );
+                        }
+                        catch( std::exception const & e )
+                        {
+                            LOG_ERROR( "Failed to start LRS_TRACE_FILE trace: " << e.what() );
+                        }
+                    } );
+}
+
+
+void start( std::string const & filename )
+{
+    tracer::instance().start( filename );
+}
+
+
+void stop()
+{
+    tracer::instance().stop();
+}
+
+
+const char * intern( std::string const & name )
+{
+    return tracer::instance().intern( name );
+}
+
+
+namespace detail {
+
+
+void record( const char * name, int64_t start_us, int64_t duration_us )
+{
+    if( is_active() )
+        tracer::instance().record( { name, start_us, duration_us } );
+}
+
+
+int64_t now_us()
+{
+    return std::chrono::duration_cast< std::chrono::microseconds >(
+               std::chrono::steady_clock::now().time_since_epoch() )
+        .count();
+}
+
+
+}  // namespace detail
+
+
+}  // namespace tracing
+}  // namespace librealsense
@@ -0,0 +1,78 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+
+namespace librealsense {
+namespace tracing {
+
+
+// Internal spans (LRS_TRACE_SCOPE) are written as Chrome trace-event JSON, viewable in chrome://tracing or Perfetto,
+// while a trace is active. A trace is started either through rs2_start_trace() or, for the whole lifetime of the
+// process, by pointing the LRS_TRACE_FILE environment variable at the output file.
+//
+// Recording a span costs a clock read and an append to a per-thread buffer; the file is written by a background
+// thread. With no active trace, a span is a single relaxed atomic load. Building with BUILD_WITH_TRACING=OFF removes
+// the spans altogether.
+
+
+// Starts writing a new trace to 'filename', ending the previous one (if any)
+void start( std::string const & filename );
+
+// Writes out all pending spans and closes the trace file
+void stop();
+
+// Starts the trace LRS_TRACE_FILE points at, if any, the first time it is called. Called when the library is first
+// used (a context or a processing block is created) rather than when it is loaded, where no thread may be started
+void start_from_environment();
+
+namespace detail {
+extern std::atomic< bool > active;
+void record( const char * name, int64_t start_us, int64_t duration_us );
+int64_t now_us();
+}  // namespace detail
+
+inline bool is_active() { return detail::active.load( std::memory_order_relaxed ); }
+
+// Span names are kept by pointer until they are written: names that are not string literals must be interned first
+const char * intern( std::string const & name );
+
+
+class span
+{
+    const char * _name;
+    int64_t _start;
+
+public:
+    explicit span( const char * name )
+        : _name( name )
+        , _start( is_active() ? detail::now_us() : -1 )
+    {
+    }
+    span( span const & ) = delete;
+    span & operator=( span const & ) = delete;
+
+    ~span()
+    {
+        if( _start >= 0 )
+            detail::record( _name, _start, detail::now_us() - _start );
+    }
+};
+
+
+}  // namespace tracing
+}  // namespace librealsense
+
+
+#ifdef BUILD_WITH_TRACING
+#define LRS_TRACE_CONCAT_( A, B ) A##B
+#define LRS_TRACE_CONCAT( A, B ) LRS_TRACE_CONCAT_( A, B )
+#define LRS_TRACE_SCOPE( NAME ) librealsense::tracing::span LRS_TRACE_CONCAT( _lrs_trace_span_, __LINE__ )( NAME )
+#else
+#define LRS_TRACE_SCOPE( NAME )
+#endif
@@ -9,6 +9,7 @@
 #include "core/notification.h"
 #include "platform/uvc-option.h"
 #include "platform/stream-profile-impl.h"
+#include "async-log.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
 
@@ -150,7 +151,7 @@ void uvc_sensor::open( const stream_profiles & requests )
                     if( msp )
                         expected_size = 64;  // 32; // D457 - WORKAROUND - SHOULD BE REMOVED AFTER CORRECTION IN DRIVER
 
-                    LOG_DEBUG( "FrameAccepted,"
+                    LOG_DEBUG_HOT( "FrameAccepted,"
                                << librealsense::get_string( req_profile_base->get_stream_type() ) << ",Counter,"
                                << std::dec << fr->additional_data.frame_number << ",Index,"
                                << req_profile_base->get_stream_index() << ",BackEndTS," << std::fixed << f.backend_time
@@ -188,6 +189,7 @@ void uvc_sensor::open( const stream_profiles & requests )
                         expected_size,
                         std::move( fr->additional_data ),
                         true );
+                    trace_frame( fh.frame, RS2_FRAME_TRACE_STAGE_ARRIVAL );
                     auto diff = time_service::get_time() - system_time;
                     if( diff > 10 )
                         LOG_DEBUG( "!! Frame allocation took " << diff << " msec" );
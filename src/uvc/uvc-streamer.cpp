@@ -2,6 +2,7 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include "uvc-streamer.h"
+#include <src/tracing.h>
 
 const int UVC_PAYLOAD_MAX_HEADER_LENGTH         = 1024;
 const int DEQUEUE_MILLISECONDS_TIMEOUT          = 50;
@@ -91,7 +92,10 @@ namespace librealsense
                 if (_queue.dequeue(&fp, DEQUEUE_MILLISECONDS_TIMEOUT))
                 {
                     if(_publish_frames && running())
+                    {
+                        LRS_TRACE_SCOPE( "uvc publish frame" );
                         _context.user_cb(_context.profile, fp->fo, []() mutable {});
+                    }
                 }
             });
 
@@ -117,6 +121,7 @@ namespace librealsense
                     if(!_running)
                       return;
 
+                    LRS_TRACE_SCOPE( "uvc bulk request" );
                     auto al = r->get_actual_length();
                     // Relax the frame size constrain for compressed streams
                     bool is_compressed = val_in_range(_context.profile.format, { 0x4d4a5047U , 0x5a313648U}); // MJPEG, Z16H
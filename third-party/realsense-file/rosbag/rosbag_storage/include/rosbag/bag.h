@@ -39,6 +39,8 @@
 #include "macros.h"
 
 #include "buffer.h"
+#include "chunk_compressor.h"
+#include "chunk_read_ahead.h"
 #include "chunked_file.h"
 #include "constants.h"
 #include "exceptions.h"
@@ -52,6 +54,7 @@
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stdexcept>
@@ -104,6 +107,16 @@ public:
      */
     void open(std::string const& filename, uint32_t mode = bagmode::Read);
 
+    //! Open a bag file for reading, with the index of its messages kept from an earlier open rather than read from the
+    //! index records that follow each chunk
+    /*!
+     * \param filename           The bag file to open
+     * \param connection_indexes The index of the messages of each connection (see getConnectionIndexes)
+     *
+     * Can throw BagException; BagFormatException if the index doesn't match the bag
+     */
+    void open(std::string const& filename, std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes);
+
     //! Close the bag file
     void close();
 
@@ -113,12 +126,32 @@ public:
     uint32_t        getMinorVersion() const;                      //!< Get the minor-version of the open bag file
     uint64_t        getSize()         const;                      //!< Get the current size of the bag file (a lower bound)
 
+    //! Get the index of the messages of each connection, by connection id
+    std::map<uint32_t, std::multiset<IndexEntry> > const& getConnectionIndexes() const;
+
     void            setCompression(CompressionType compression);  //!< Set the compression method to use for writing chunks
     CompressionType getCompression() const;                       //!< Get the compression method to use for writing chunks
     std::tuple<std::string, uint64_t, uint64_t> getCompressionInfo() const;
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
 
+    //! Compress chunks on worker threads rather than while writing messages (LZ4 only; other compressions are
+    //! unaffected). Chunks are written in order, so the bag is the same either way.
+    /*!
+     * \param threads     Number of compression threads; 0 compresses while writing (the default)
+     * \param max_pending Maximum number of chunks being compressed or waiting to be written; writing a message
+     *                    blocks until there's room again. 0 for twice the number of threads.
+     */
+    void            setCompressionThreads(uint32_t threads, uint32_t max_pending = 0);
+
+    //! While reading, decompress the chunks following the one being read on worker threads, so they're ready by the
+    //! time they're read (LZ4 only; uncompressed chunks are read as they are).
+    /*!
+     * \param threads Number of decompression threads; 0 decompresses each chunk when it's read (the default)
+     * \param chunks  Number of chunks to read ahead. 0 for twice the number of threads.
+     */
+    void            setReadAhead(uint32_t threads, uint32_t chunks = 0);
+
     //! Write a message into the bag file
     /*!
      * \param topic The topic name
@@ -196,12 +229,14 @@ private:
     void appendConnectionRecordToBuffer(Buffer& buf, ConnectionInfo const* connection_info);
     template<class T>
     void writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& time, T const& msg);
-    void writeIndexRecords();
+    void writeIndexRecords(std::map<uint32_t, std::multiset<IndexEntry> > const& chunk_connection_indexes);
     void writeConnectionRecords();
     void writeChunkInfoRecords();
     void startWritingChunk(rs2rosinternal::Time time);
     void writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size);
     void stopWritingChunk();
+    void writePendingChunks(bool wait_for_all);
+    void writePendingChunk(std::unique_ptr<PendingChunk> chunk);
 
     // Reading
 
@@ -218,6 +253,9 @@ private:
 
     rs2rosinternal::Header readMessageDataHeader(IndexEntry const& index_entry);
     uint32_t    readMessageDataSize(IndexEntry const& index_entry) const;
+    uint32_t    readMessageDataPrefix(IndexEntry const& index_entry, uint8_t* buffer, uint32_t size) const;
+    bool        getMappedMessageData(IndexEntry const& index_entry, uint8_t const*& data, uint32_t& size,
+                                     std::shared_ptr<void const>& mapping) const;
 
     template<typename Stream>
     void readMessageDataIntoStream(IndexEntry const& index_entry, Stream& stream) const;
@@ -226,6 +264,7 @@ private:
     void     decompressRawChunk(ChunkHeader const& chunk_header) const;
     void     decompressBz2Chunk(ChunkHeader const& chunk_header) const;
     void     decompressLz4Chunk(ChunkHeader const& chunk_header) const;
+    void     readAhead(uint64_t chunk_pos) const;
     uint32_t getChunkOffset() const;
 
     // Record header I/O
@@ -282,9 +321,20 @@ private:
 
     // Current chunk
     bool      chunk_open_;
+    bool      chunk_deferred_;      //!< the current chunk is only in outgoing_chunk_buffer_, for the compressor
     ChunkInfo curr_chunk_info_;
     uint64_t  curr_chunk_data_pos_;
 
+    // Parallel compression (see setCompressionThreads)
+    std::unique_ptr<ChunkCompressor> compressor_;
+    uint32_t                         max_pending_chunks_;
+    std::vector<std::unique_ptr<PendingChunk> > spare_chunks_;  //!< written chunks, to reuse their buffers
+
+    // Read-ahead (see setReadAhead)
+    std::unique_ptr<ChunkReadAhead>  read_ahead_;
+    uint32_t                         read_ahead_chunks_;
+    mutable std::vector<std::shared_ptr<ReadAheadChunk> > spare_read_chunks_;  //!< read chunks, to reuse their buffers
+
     std::map<std::string, uint32_t>                topic_connection_ids_;
     std::map<rs2rosinternal::M_string, uint32_t>              header_connection_ids_;
     std::map<uint32_t, ConnectionInfo*>            connections_;
@@ -538,7 +588,8 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
             }
             connections_[conn_id] = connection_info;
 
-            writeConnectionRecord(connection_info);
+            if (!chunk_deferred_)
+                writeConnectionRecord(connection_info);
             appendConnectionRecordToBuffer(outgoing_chunk_buffer_, connection_info);
         }
 
@@ -550,8 +601,11 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
 
         std::multiset<IndexEntry>& chunk_connection_index = curr_chunk_connection_indexes_[connection_info->id];
         chunk_connection_index.insert(chunk_connection_index.end(), index_entry);
-        std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
-        connection_index.insert(connection_index.end(), index_entry);
+        if (!chunk_deferred_) {
+            // Otherwise the chunk position is not known yet: added when the chunk is written
+            std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
+            connection_index.insert(connection_index.end(), index_entry);
+        }
 
         // Increment the connection count
         curr_chunk_info_.connection_counts[connection_info->id]++;
@@ -599,9 +653,11 @@ void Bag::writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& t
     CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [%llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
               (unsigned long long) file_.getOffset(), getChunkOffset(), conn_id, time.sec, time.nsec, msg_ser_len);
 
-    writeHeader(header);
-    writeDataLength(msg_ser_len);
-    write((char*) record_buffer_.getData(), msg_ser_len);
+    if (!chunk_deferred_) {
+        writeHeader(header);
+        writeDataLength(msg_ser_len);
+        write((char*) record_buffer_.getData(), msg_ser_len);
+    }
 
     // todo: use better abstraction than appendHeaderToBuffer
     appendHeaderToBuffer(outgoing_chunk_buffer_, header);
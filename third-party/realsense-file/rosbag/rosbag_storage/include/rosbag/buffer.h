@@ -51,6 +51,11 @@ public:
     uint32_t getSize()     const;
 
     void setSize(uint32_t size);
+    void swap(Buffer& other);
+
+    //! Makes the buffer refer to data it does not own (e.g., a mapped file) until its size is next set; the data must
+    //! outlive this, and is not written to
+    void setView(uint8_t const* data, uint32_t size);
 
 private:
     void ensureCapacity(uint32_t capacity);
@@ -59,6 +64,7 @@ private:
     uint8_t* buffer_;
     uint32_t capacity_;
     uint32_t size_;
+    uint8_t const* view_;
 };
 
 } // namespace rosbag
@@ -0,0 +1,74 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifndef ROSBAG_CHUNK_COMPRESSOR_H
+#define ROSBAG_CHUNK_COMPRESSOR_H
+
+#include "macros.h"
+
+#include "buffer.h"
+#include "stream.h"
+#include "structures.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace rosbag {
+
+//! A chunk whose messages were all written, waiting to be compressed and then written to the bag
+struct ROSBAG_DECL PendingChunk
+{
+    CompressionType compression;
+    ChunkInfo       info;                   //!< pos is only known once written
+    std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes;  //!< chunk_pos is only known once written
+    Buffer          uncompressed;
+    std::vector<uint8_t> compressed;        //!< valid once compressed
+
+    bool               done = false;
+    std::exception_ptr error;
+};
+
+//! Compresses chunks on a pool of worker threads; chunks are handed back in the order they were pushed, so the bag
+//! layout is the same as when compressing while writing
+class ROSBAG_DECL ChunkCompressor
+{
+public:
+    explicit ChunkCompressor(uint32_t threads);
+    ~ChunkCompressor();
+
+    ChunkCompressor(ChunkCompressor const&) = delete;
+    ChunkCompressor& operator=(ChunkCompressor const&) = delete;
+
+    void push(std::unique_ptr<PendingChunk> chunk);
+
+    //! Returns the oldest chunk once it's compressed: waits for it if wait is true, otherwise returns nullptr if it's
+    //! not ready yet. Rethrows any compression error.
+    std::unique_ptr<PendingChunk> pop(bool wait);
+
+    //! Number of chunks pushed and not popped
+    size_t size() const;
+
+    static void compress(PendingChunk& chunk);
+
+private:
+    void work();
+
+    mutable std::mutex          mutex_;
+    std::condition_variable     work_cv_;  //!< workers wait for chunks to compress
+    std::condition_variable     done_cv_;  //!< pop waits for the oldest chunk
+    std::deque<std::unique_ptr<PendingChunk> > chunks_;  //!< in push order
+    size_t                      next_to_compress_;       //!< index into chunks_
+    bool                        stopping_;
+    std::vector<std::thread>    workers_;
+};
+
+} // namespace rosbag
+
+#endif
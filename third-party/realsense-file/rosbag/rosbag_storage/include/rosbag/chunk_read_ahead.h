@@ -0,0 +1,80 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifndef ROSBAG_CHUNK_READ_AHEAD_H
+#define ROSBAG_CHUNK_READ_AHEAD_H
+
+#include "macros.h"
+
+#include "buffer.h"
+#include "stream.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace rosbag {
+
+//! A chunk ahead of the one being read, to be decompressed before it's needed
+struct ROSBAG_DECL ReadAheadChunk
+{
+    uint64_t        pos;                    //!< position of the chunk record in the bag
+    CompressionType compression;
+    uint8_t const*  source;                 //!< the compressed data: mapped from the bag, or in compressed
+    uint32_t        source_size;
+    Buffer          compressed;             //!< the compressed data, when the bag isn't mapped
+    Buffer          decompressed;           //!< sized for the uncompressed data; valid once done
+
+    bool               started = false;
+    bool               done = false;
+    std::exception_ptr error;
+};
+
+//! Decompresses chunks on a pool of worker threads, in the order they were pushed, until they're taken by position
+class ROSBAG_DECL ChunkReadAhead
+{
+public:
+    explicit ChunkReadAhead(uint32_t threads);
+    ~ChunkReadAhead();
+
+    ChunkReadAhead(ChunkReadAhead const&) = delete;
+    ChunkReadAhead& operator=(ChunkReadAhead const&) = delete;
+
+    void push(std::shared_ptr<ReadAheadChunk> chunk);
+
+    //! Returns the chunk at pos once it's decompressed, or nullptr if it wasn't pushed (or was dropped). A chunk no
+    //! worker has started on yet is decompressed right away, rather than waited for. Rethrows any decompression error.
+    std::shared_ptr<ReadAheadChunk> take(uint64_t pos);
+
+    bool contains(uint64_t pos) const;
+
+    //! Drops the chunks that aren't in keep; those being decompressed are dropped once done
+    void retain(std::set<uint64_t> const& keep);
+
+    //! Drops all chunks, waiting for those being decompressed (whose source may be about to be unmapped)
+    void clear();
+
+    static void decompress(ReadAheadChunk& chunk);
+
+private:
+    void work();
+
+    mutable std::mutex          mutex_;
+    std::condition_variable     work_cv_;  //!< workers wait for chunks to decompress
+    std::condition_variable     done_cv_;  //!< take and clear wait for chunks being decompressed
+    std::map<uint64_t, std::shared_ptr<ReadAheadChunk> > chunks_;  //!< pushed and not taken, by position
+    std::deque<std::shared_ptr<ReadAheadChunk> > queue_;          //!< not started yet, in push order
+    size_t                      busy_;     //!< number of chunks being decompressed
+    bool                        stopping_;
+    std::vector<std::thread>    workers_;
+};
+
+} // namespace rosbag
+
+#endif
@@ -77,6 +77,22 @@ public:
     void        seek(uint64_t offset, int origin = std::ios_base::beg); //!< seek to given offset from origin
     void        decompress(CompressionType compression, uint8_t* dest, unsigned int dest_len, uint8_t* source, unsigned int source_len);
 
+    //! Files opened for reading are memory-mapped, when possible: returns the mapped bytes at the given offset, or
+    //! NULL if they're not mapped (and have to be read), or the file no longer holds them (it was truncated)
+    uint8_t const* getMapped(uint64_t offset, uint64_t size) const;
+
+    //! Whether the given bytes are in the mapping (rather than, e.g., a copy read from the file)
+    bool isMapped(uint8_t const* data, uint64_t size) const {
+        return mapped_ && data >= mapped_ && data <= mapped_ + mapped_size_ && size <= uint64_t(mapped_ + mapped_size_ - data);
+    }
+
+    //! Keeps the mapped bytes valid, even once the file is closed
+    std::shared_ptr<void const> getMapping() const { return mapping_; }
+
+private:
+    void map();
+    void unmap();
+
 private:
     void open(std::string const& filename, std::string const& mode);
     void clearUnused();
@@ -89,6 +105,10 @@ private:
     char*       unused_;         //!< extra data read by compressed stream
     int         nUnused_;        //!< number of bytes of extra data read by compressed stream
 
+    uint8_t const* mapped_;      //!< the file mapped for reading, or NULL
+    uint64_t    mapped_size_;
+    std::shared_ptr<void const> mapping_;  //!< unmaps once nothing refers to the mapped bytes any more
+
     std::shared_ptr<StreamFactory> stream_factory_;
 
     std::shared_ptr<Stream> read_stream_;
@@ -93,6 +93,14 @@ public:
     //! Size of serialized message
     uint32_t size() const;
 
+    //! Copies up to 'size' bytes from the start of the serialized message, without reading the rest of it; returns
+    //! how many were copied
+    uint32_t readPrefix(uint8_t* buffer, uint32_t size) const;
+
+    //! Points at the serialized message contents in place, when the bag is memory-mapped and the message is not
+    //! compressed: 'mapping' then keeps them valid, even once the bag is closed. Returns false otherwise.
+    bool getMappedData(uint8_t const*& data, uint32_t& size, std::shared_ptr<void const>& mapping) const;
+
 private:
     MessageInstance(ConnectionInfo const* connection_info, IndexEntry const& index, Bag const& bag);
 
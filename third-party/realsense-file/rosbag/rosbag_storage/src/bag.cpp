@@ -37,6 +37,7 @@
 #endif
 #include <signal.h>
 #include <assert.h>
+#include <algorithm>
 #include <iomanip>
 #include <map>
 #include <tuple>
@@ -67,7 +68,10 @@ Bag::Bag() :
     connection_count_(0),
     chunk_count_(0),
     chunk_open_(false),
+    chunk_deferred_(false),
     curr_chunk_data_pos_(0),
+    max_pending_chunks_(0),
+    read_ahead_chunks_(0),
     current_buffer_(0),
     decompressed_chunk_(0)
 {
@@ -83,7 +87,10 @@ Bag::Bag(string const& filename, uint32_t mode) :
     connection_count_(0),
     chunk_count_(0),
     chunk_open_(false),
+    chunk_deferred_(false),
     curr_chunk_data_pos_(0),
+    max_pending_chunks_(0),
+    read_ahead_chunks_(0),
     current_buffer_(0),
     decompressed_chunk_(0)
 {
@@ -113,13 +120,30 @@ void Bag::open(string const& filename, uint32_t mode) {
     seek(offset);
 }
 
+void Bag::open(string const& filename, map<uint32_t, multiset<IndexEntry> > connection_indexes) {
+    // Taken as they are by startReadingVersion200
+    connection_indexes_ = std::move(connection_indexes);
+    try {
+        open(filename, bagmode::Read);
+    }
+    catch (...) {
+        close();
+        connection_indexes_.clear();
+        throw;
+    }
+}
+
 void Bag::openRead(string const& filename) {
     file_.openRead(filename);
 
     readVersion();
 
     switch (version_) {
-    case 102: startReadingVersion102(); break;
+    case 102:
+        if (!connection_indexes_.empty())
+            throw BagException("Bag file version 1.2 is unsupported for opening with an index");
+        startReadingVersion102();
+        break;
     case 200: startReadingVersion200(); break;
     default:
         throw BagException( "Unsupported bag file version: " + std::to_string( getMajorVersion() ) + '.'
@@ -163,6 +187,11 @@ void Bag::close() {
     if (mode_ & bagmode::Write || mode_ & bagmode::Append)
         closeWrite();
 
+    // Before unmapping what they're decompressed from
+    if (read_ahead_)
+        read_ahead_->clear();
+    decompressed_chunk_ = 0;
+
     file_.close();
 
     topic_connection_ids_.clear();
@@ -173,6 +202,7 @@ void Bag::close() {
     chunks_.clear();
     connection_indexes_.clear();
     curr_chunk_connection_indexes_.clear();
+    spare_chunks_.clear();
 }
 
 void Bag::closeWrite() {
@@ -183,6 +213,8 @@ string   Bag::getFileName() const { return file_.getFileName(); }
 BagMode  Bag::getMode()     const { return mode_;               }
 uint64_t Bag::getSize()     const { return file_size_;          }
 
+map<uint32_t, multiset<IndexEntry> > const& Bag::getConnectionIndexes() const { return connection_indexes_; }
+
 uint32_t Bag::getChunkThreshold() const { return chunk_threshold_; }
 
 void Bag::setChunkThreshold(uint32_t chunk_threshold) {
@@ -194,6 +226,27 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
 
 CompressionType Bag::getCompression() const { return compression_; }
 
+void Bag::setCompressionThreads(uint32_t threads, uint32_t max_pending) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+    if (file_.isOpen())
+        writePendingChunks(true);
+
+    compressor_.reset();
+    spare_chunks_.clear();
+    if (threads)
+        compressor_.reset(new ChunkCompressor(threads));
+    max_pending_chunks_ = max_pending ? max_pending : 2 * threads;
+}
+
+void Bag::setReadAhead(uint32_t threads, uint32_t chunks) {
+    read_ahead_.reset();
+    spare_read_chunks_.clear();
+    if (threads)
+        read_ahead_.reset(new ChunkReadAhead(threads));
+    read_ahead_chunks_ = chunks ? chunks : 2 * threads;
+}
+
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
 {
     std::map<std::string, uint64_t> compression_counts;
@@ -292,6 +345,7 @@ void Bag::startWriting() {
 void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
+    writePendingChunks(true);
 
     seek(0, std::ios::end);
 
@@ -318,6 +372,22 @@ void Bag::startReadingVersion200() {
     for (uint32_t i = 0; i < chunk_count_; i++)
         readChunkInfoRecord();
 
+    // The connection indexes were given: check they have as many messages as the chunks
+    if (!connection_indexes_.empty()) {
+        map<uint32_t, size_t> counts;
+        for (ChunkInfo const& chunk_info : chunks_)
+            for (map<uint32_t, uint32_t>::const_iterator i = chunk_info.connection_counts.begin(); i != chunk_info.connection_counts.end(); ++i)
+                counts[i->first] += i->second;
+        for (map<uint32_t, size_t>::const_iterator i = counts.begin(); i != counts.end(); ++i) {
+            map<uint32_t, multiset<IndexEntry> >::const_iterator index = connection_indexes_.find(i->first);
+            if (index == connection_indexes_.end() || index->second.size() != i->second)
+                throw BagFormatException("Connection index doesn't match the bag");
+        }
+        if (counts.size() != connection_indexes_.size())
+            throw BagFormatException("Connection index doesn't match the bag");
+        return;
+    }
+
     // Read the connection indexes for each chunk
     for( ChunkInfo const & chunk_info : chunks_ )
     {
@@ -438,18 +508,33 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (chunk_deferred_)
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
 }
 
 void Bag::startWritingChunk(Time time) {
+    // With a compressor, the chunk is only assembled in outgoing_chunk_buffer_ and written once compressed
+    chunk_deferred_ = compressor_ && compression_ == compression::LZ4;
+    if (!chunk_deferred_ && compressor_ && compressor_->size()) {
+        // Chunks written directly must come after the pending ones
+        writePendingChunks(true);
+        seek(0, std::ios::end);
+    }
+
     // Initialize chunk info
     curr_chunk_info_.pos        = file_.getOffset();
     curr_chunk_info_.start_time = time;
     curr_chunk_info_.end_time   = time;
 
+    if (chunk_deferred_) {
+        chunk_open_ = true;
+        return;
+    }
+
     // Write the chunk header, with a place-holder for the data sizes (we'll fill in when the chunk is finished)
     writeChunkHeader(compression_, 0, 0);
 
@@ -463,6 +548,32 @@ void Bag::startWritingChunk(Time time) {
 }
 
 void Bag::stopWritingChunk() {
+    if (chunk_deferred_) {
+        std::unique_ptr<PendingChunk> chunk;
+        if (spare_chunks_.empty())
+            chunk.reset(new PendingChunk);
+        else {
+            chunk = std::move(spare_chunks_.back());
+            spare_chunks_.pop_back();
+            chunk->connection_indexes.clear();
+            chunk->done = false;
+        }
+        chunk->compression = compression_;
+        chunk->info = curr_chunk_info_;
+        chunk->connection_indexes.swap(curr_chunk_connection_indexes_);
+        // The chunk's buffer, if reused, already has the capacity we need
+        chunk->uncompressed.swap(outgoing_chunk_buffer_);
+        outgoing_chunk_buffer_.setSize(0);
+        compressor_->push(std::move(chunk));
+
+        curr_chunk_info_.connection_counts.clear();
+        chunk_open_ = false;
+        chunk_deferred_ = false;
+
+        writePendingChunks(false);
+        return;
+    }
+
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
@@ -479,7 +590,7 @@ void Bag::stopWritingChunk() {
 
     // Write out the indexes and clear them
     seek(end_of_chunk_pos);
-    writeIndexRecords();
+    writeIndexRecords(curr_chunk_connection_indexes_);
     curr_chunk_connection_indexes_.clear();
 
     // Clear the connection counts
@@ -489,6 +600,39 @@ void Bag::stopWritingChunk() {
     chunk_open_ = false;
 }
 
+void Bag::writePendingChunks(bool wait_for_all) {
+    if (!compressor_)
+        return;
+
+    // Write whatever is ready, then wait for the oldest chunks while there are too many pending
+    while (std::unique_ptr<PendingChunk> chunk = compressor_->pop(false))
+        writePendingChunk(std::move(chunk));
+    while (compressor_->size() > (wait_for_all ? 0 : max_pending_chunks_))
+        writePendingChunk(compressor_->pop(true));
+}
+
+void Bag::writePendingChunk(std::unique_ptr<PendingChunk> chunk) {
+    seek(0, std::ios::end);
+    chunk->info.pos = file_.getOffset();
+
+    writeChunkHeader(chunk->compression, static_cast<uint32_t>(chunk->compressed.size()), chunk->uncompressed.getSize());
+    write((char*) chunk->compressed.data(), chunk->compressed.size());
+    writeIndexRecords(chunk->connection_indexes);
+    file_size_ = file_.getOffset();
+
+    chunks_.push_back(chunk->info);
+    for (auto& kvp : chunk->connection_indexes) {
+        std::multiset<IndexEntry>& connection_index = connection_indexes_[kvp.first];
+        for (IndexEntry entry : kvp.second) {
+            entry.chunk_pos = chunk->info.pos;
+            connection_index.insert(connection_index.end(), entry);
+        }
+    }
+
+    if (spare_chunks_.size() <= max_pending_chunks_)
+        spare_chunks_.push_back(std::move(chunk));
+}
+
 void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size) {
     ChunkHeader chunk_header;
     switch (compression) {
@@ -530,8 +674,8 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
-void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& chunk_connection_indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = chunk_connection_indexes.begin(); i != chunk_connection_indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -793,24 +937,78 @@ void Bag::decompressChunk(uint64_t chunk_pos) const {
     if (decompressed_chunk_ == chunk_pos)
         return;
 
-    // Seek to the start of the chunk
-    seek(chunk_pos);
+    if (std::shared_ptr<ReadAheadChunk> chunk = read_ahead_ ? read_ahead_->take(chunk_pos) : nullptr) {
+        decompress_buffer_.swap(chunk->decompressed);
+        if (spare_read_chunks_.size() < read_ahead_chunks_)
+            spare_read_chunks_.push_back(std::move(chunk));
+    }
+    else {
+        // Seek to the start of the chunk
+        seek(chunk_pos);
 
-    // Read the chunk header
-    ChunkHeader chunk_header;
-    readChunkHeader(chunk_header);
-
-    // Read and decompress the chunk.  These assume we are at the right place in the stream already
-    if (chunk_header.compression == COMPRESSION_NONE)
-        decompressRawChunk(chunk_header);
-    else if (chunk_header.compression == COMPRESSION_BZ2)
-        decompressBz2Chunk(chunk_header);
-    else if (chunk_header.compression == COMPRESSION_LZ4)
-        decompressLz4Chunk(chunk_header);
-    else
-        throw BagFormatException("Unknown compression: " + chunk_header.compression);
+        // Read the chunk header
+        ChunkHeader chunk_header;
+        readChunkHeader(chunk_header);
+
+        // Read and decompress the chunk.  These assume we are at the right place in the stream already
+        if (chunk_header.compression == COMPRESSION_NONE)
+            decompressRawChunk(chunk_header);
+        else if (chunk_header.compression == COMPRESSION_BZ2)
+            decompressBz2Chunk(chunk_header);
+        else if (chunk_header.compression == COMPRESSION_LZ4)
+            decompressLz4Chunk(chunk_header);
+        else
+            throw BagFormatException("Unknown compression: " + chunk_header.compression);
+    }
 
     decompressed_chunk_ = chunk_pos;
+
+    if (read_ahead_ && mode_ == bagmode::Read)
+        readAhead(chunk_pos);
+}
+
+void Bag::readAhead(uint64_t chunk_pos) const {
+    // Chunks are read in the order they were written, which is their order in the file
+    std::vector<ChunkInfo>::const_iterator next = std::upper_bound(chunks_.begin(), chunks_.end(), chunk_pos,
+        [](uint64_t pos, ChunkInfo const& info) { return pos < info.pos; });
+    std::vector<ChunkInfo>::const_iterator const end = next + std::min<size_t>(read_ahead_chunks_, chunks_.end() - next);
+
+    // Whatever was read ahead of a chunk we seeked away from is dropped
+    std::set<uint64_t> ahead;
+    for (std::vector<ChunkInfo>::const_iterator i = next; i != end; ++i)
+        ahead.insert(i->pos);
+    read_ahead_->retain(ahead);
+
+    for (; next != end; ++next) {
+        if (read_ahead_->contains(next->pos))
+            continue;
+
+        seek(next->pos);
+        ChunkHeader chunk_header;
+        readChunkHeader(chunk_header);
+        if (chunk_header.compression != COMPRESSION_LZ4)
+            continue;
+
+        std::shared_ptr<ReadAheadChunk> chunk;
+        if (spare_read_chunks_.empty())
+            chunk = std::make_shared<ReadAheadChunk>();
+        else {
+            chunk = std::move(spare_read_chunks_.back());
+            spare_read_chunks_.pop_back();
+            chunk->started = chunk->done = false;
+            chunk->error = nullptr;
+        }
+        chunk->pos = next->pos;
+        chunk->compression = compression::LZ4;
+        chunk->source_size = chunk_header.compressed_size;
+        if (!(chunk->source = file_.getMapped(file_.getOffset(), chunk_header.compressed_size))) {
+            chunk->compressed.setSize(chunk_header.compressed_size);
+            file_.read((char*) chunk->compressed.getData(), chunk_header.compressed_size);
+            chunk->source = chunk->compressed.getData();
+        }
+        chunk->decompressed.setSize(chunk_header.uncompressed_size);
+        read_ahead_->push(std::move(chunk));
+    }
 }
 
 void Bag::readMessageDataRecord102(uint64_t offset, rs2rosinternal::Header& header) const {
@@ -842,6 +1040,12 @@ void Bag::decompressRawChunk(ChunkHeader const& chunk_header) const {
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
+    // Messages are then deserialized straight from the mapped file, with no copy of the chunk
+    if (uint8_t const* mapped = file_.getMapped(file_.getOffset(), chunk_header.compressed_size)) {
+        decompress_buffer_.setView(mapped, chunk_header.compressed_size);
+        return;
+    }
+
     decompress_buffer_.setSize(chunk_header.compressed_size);
     file_.read((char*) decompress_buffer_.getData(), chunk_header.compressed_size);
 
@@ -855,8 +1059,13 @@ void Bag::decompressBz2Chunk(ChunkHeader const& chunk_header) const {
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    // Decompressed straight from the mapped file, if it is
+    if (uint8_t const* mapped = file_.getMapped(file_.getOffset(), chunk_header.compressed_size))
+        chunk_buffer_.setView(mapped, chunk_header.compressed_size);
+    else {
+        chunk_buffer_.setSize(chunk_header.compressed_size);
+        file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    }
 
     decompress_buffer_.setSize(chunk_header.uncompressed_size);
     file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
@@ -872,8 +1081,13 @@ void Bag::decompressLz4Chunk(ChunkHeader const& chunk_header) const {
     CONSOLE_BRIDGE_logDebug("lz4 compressed_size: %d uncompressed_size: %d",
              chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    // Decompressed straight from the mapped file, if it is
+    if (uint8_t const* mapped = file_.getMapped(file_.getOffset(), chunk_header.compressed_size))
+        chunk_buffer_.setView(mapped, chunk_header.compressed_size);
+    else {
+        chunk_buffer_.setSize(chunk_header.compressed_size);
+        file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    }
 
     decompress_buffer_.setSize(chunk_header.uncompressed_size);
     file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
@@ -918,6 +1132,48 @@ uint32_t Bag::readMessageDataSize(IndexEntry const& index_entry) const {
     }
 }
 
+uint32_t Bag::readMessageDataPrefix(IndexEntry const& index_entry, uint8_t* buffer, uint32_t size) const {
+    rs2rosinternal::Header header;
+    uint32_t data_size;
+    uint32_t bytes_read;
+    uint8_t const* data;
+    switch (version_)
+    {
+    case 200:
+        decompressChunk(index_entry.chunk_pos);
+        readMessageDataHeaderFromBuffer(*current_buffer_, index_entry.offset, header, data_size, bytes_read);
+        data = current_buffer_->getData() + index_entry.offset + bytes_read;
+        break;
+    case 102:
+        readMessageDataRecord102(index_entry.chunk_pos, header);
+        data_size = record_buffer_.getSize();
+        data = record_buffer_.getData();
+        break;
+    default:
+        throw BagFormatException( "Unhandled version: " + std::to_string( version_ ) );
+    }
+    size = std::min(size, data_size);
+    memcpy(buffer, data, size);
+    return size;
+}
+
+bool Bag::getMappedMessageData(IndexEntry const& index_entry, uint8_t const*& data, uint32_t& size,
+                               std::shared_ptr<void const>& mapping) const {
+    if (version_ != 200)
+        return false;
+
+    // Uncompressed chunks of a mapped file are used in place (see decompressRawChunk)
+    rs2rosinternal::Header header;
+    uint32_t bytes_read;
+    decompressChunk(index_entry.chunk_pos);
+    readMessageDataHeaderFromBuffer(*current_buffer_, index_entry.offset, header, size, bytes_read);
+    data = current_buffer_->getData() + index_entry.offset + bytes_read;
+    if (!file_.isMapped(data, size))
+        return false;
+    mapping = file_.getMapping();
+    return true;
+}
+
 void Bag::writeChunkInfoRecords() {
     for( ChunkInfo const & chunk_info : chunks_ )
     {
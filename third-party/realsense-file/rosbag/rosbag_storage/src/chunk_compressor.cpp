@@ -0,0 +1,112 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/chunk_compressor.h"
+#include "rosbag/exceptions.h"
+
+#include <string>
+
+namespace rosbag {
+
+// Same as LZ4Stream, so the chunks are the same whichever way they're compressed
+static const int LZ4_BLOCK_SIZE_ID = 6;
+
+ChunkCompressor::ChunkCompressor(uint32_t threads)
+    : next_to_compress_(0)
+    , stopping_(false)
+{
+    if (threads == 0)
+        throw BagException("Chunk compression requires at least one thread");
+    for (uint32_t i = 0; i < threads; ++i)
+        workers_.emplace_back([this]() { work(); });
+}
+
+ChunkCompressor::~ChunkCompressor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void ChunkCompressor::push(std::unique_ptr<PendingChunk> chunk) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunks_.push_back(std::move(chunk));
+    }
+    work_cv_.notify_one();
+}
+
+std::unique_ptr<PendingChunk> ChunkCompressor::pop(bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (chunks_.empty())
+        return nullptr;
+    if (!chunks_.front()->done) {
+        if (!wait)
+            return nullptr;
+        done_cv_.wait(lock, [this]() { return chunks_.front()->done; });
+    }
+    std::unique_ptr<PendingChunk> chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    --next_to_compress_;  // the chunk was taken by a worker, so this is at least 1
+    lock.unlock();
+
+    if (chunk->error)
+        std::rethrow_exception(chunk->error);
+    return chunk;
+}
+
+size_t ChunkCompressor::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return chunks_.size();
+}
+
+void ChunkCompressor::work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        work_cv_.wait(lock, [this]() { return stopping_ || next_to_compress_ < chunks_.size(); });
+        if (stopping_)
+            return;
+
+        PendingChunk* chunk = chunks_[next_to_compress_++].get();
+        lock.unlock();
+        try {
+            compress(*chunk);
+        }
+        catch (...) {
+            chunk->error = std::current_exception();
+        }
+        lock.lock();
+        chunk->done = true;
+        done_cv_.notify_all();
+    }
+}
+
+void ChunkCompressor::compress(PendingChunk& chunk) {
+    if (chunk.compression != compression::LZ4)
+        throw BagException("Unsupported chunk compression: " + std::to_string((int)chunk.compression));
+
+    unsigned int const input_size = chunk.uncompressed.getSize();
+    // LZ4's worst case, plus the stream header, the size of each block, and the end mark and checksum
+    unsigned int const blocks = input_size / roslz4_blockSizeFromIndex(LZ4_BLOCK_SIZE_ID) + 1;
+    unsigned int capacity = input_size + input_size / 255 + 16 * blocks + 64;
+    while (true) {
+        chunk.compressed.resize(capacity);
+        unsigned int output_size = capacity;
+        int ret = roslz4_buffToBuffCompress((char*)chunk.uncompressed.getData(), input_size,
+                                            (char*)chunk.compressed.data(), &output_size, LZ4_BLOCK_SIZE_ID);
+        switch (ret) {
+        case ROSLZ4_OK:
+            chunk.compressed.resize(output_size);
+            return;
+        case ROSLZ4_OUTPUT_SMALL: capacity *= 2; break;
+        case ROSLZ4_MEMORY_ERROR: throw BagIOException("ROSLZ4_MEMORY_ERROR: insufficient memory available");
+        case ROSLZ4_PARAM_ERROR: throw BagIOException("ROSLZ4_PARAM_ERROR: bad block size");
+        default: throw BagIOException("ROSLZ4_ERROR: compression error");
+        }
+    }
+}
+
+} // namespace rosbag
@@ -0,0 +1,134 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/chunk_read_ahead.h"
+#include "rosbag/exceptions.h"
+
+#include <algorithm>
+#include <string>
+
+namespace rosbag {
+
+ChunkReadAhead::ChunkReadAhead(uint32_t threads)
+    : busy_(0)
+    , stopping_(false)
+{
+    if (threads == 0)
+        throw BagException("Chunk read-ahead requires at least one thread");
+    for (uint32_t i = 0; i < threads; ++i)
+        workers_.emplace_back([this]() { work(); });
+}
+
+ChunkReadAhead::~ChunkReadAhead() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void ChunkReadAhead::push(std::shared_ptr<ReadAheadChunk> chunk) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunks_[chunk->pos] = chunk;
+        queue_.push_back(std::move(chunk));
+    }
+    work_cv_.notify_one();
+}
+
+std::shared_ptr<ReadAheadChunk> ChunkReadAhead::take(uint64_t pos) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = chunks_.find(pos);
+    if (it == chunks_.end())
+        return nullptr;
+    std::shared_ptr<ReadAheadChunk> chunk = std::move(it->second);
+    chunks_.erase(it);
+
+    if (!chunk->started) {
+        queue_.erase(std::find(queue_.begin(), queue_.end(), chunk));
+        lock.unlock();
+        decompress(*chunk);
+        return chunk;
+    }
+
+    done_cv_.wait(lock, [&chunk]() { return chunk->done; });
+    lock.unlock();
+
+    if (chunk->error)
+        std::rethrow_exception(chunk->error);
+    return chunk;
+}
+
+bool ChunkReadAhead::contains(uint64_t pos) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return chunks_.count(pos) != 0;
+}
+
+void ChunkReadAhead::retain(std::set<uint64_t> const& keep) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = chunks_.begin(); it != chunks_.end();) {
+        if (keep.count(it->first))
+            ++it;
+        else
+            it = chunks_.erase(it);
+    }
+    queue_.erase(std::remove_if(queue_.begin(), queue_.end(),
+                                [&keep](std::shared_ptr<ReadAheadChunk> const& chunk) { return !keep.count(chunk->pos); }),
+                 queue_.end());
+}
+
+void ChunkReadAhead::clear() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    chunks_.clear();
+    queue_.clear();
+    done_cv_.wait(lock, [this]() { return busy_ == 0; });
+}
+
+void ChunkReadAhead::work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        work_cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+        if (stopping_)
+            return;
+
+        std::shared_ptr<ReadAheadChunk> chunk = std::move(queue_.front());
+        queue_.pop_front();
+        chunk->started = true;
+        ++busy_;
+        lock.unlock();
+        try {
+            decompress(*chunk);
+        }
+        catch (...) {
+            chunk->error = std::current_exception();
+        }
+        lock.lock();
+        chunk->done = true;
+        --busy_;
+        done_cv_.notify_all();
+    }
+}
+
+void ChunkReadAhead::decompress(ReadAheadChunk& chunk) {
+    if (chunk.compression != compression::LZ4)
+        throw BagException("Unsupported chunk compression: " + std::to_string((int)chunk.compression));
+
+    unsigned int const dest_len = chunk.decompressed.getSize();
+    unsigned int actual_dest_len = dest_len;
+    int ret = roslz4_buffToBuffDecompress((char*)chunk.source, chunk.source_size,
+                                          (char*)chunk.decompressed.getData(), &actual_dest_len);
+    switch (ret) {
+    case ROSLZ4_OK: break;
+    case ROSLZ4_ERROR: throw BagException("ROSLZ4_ERROR: decompression error");
+    case ROSLZ4_MEMORY_ERROR: throw BagException("ROSLZ4_MEMORY_ERROR: insufficient memory available");
+    case ROSLZ4_OUTPUT_SMALL: throw BagException("ROSLZ4_OUTPUT_SMALL: output buffer is too small");
+    case ROSLZ4_DATA_ERROR: throw BagException("ROSLZ4_DATA_ERROR: malformed data to decompress");
+    default: throw BagException("Unhandled return code");
+    }
+    if (actual_dest_len != dest_len)
+        throw BagException("Decompression size mismatch in LZ4 chunk");
+}
+
+} // namespace rosbag
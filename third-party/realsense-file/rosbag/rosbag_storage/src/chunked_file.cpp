@@ -49,8 +49,18 @@
 #        define fileno _fileno
 #        define ftruncate _chsize_s //Intel Realsense Change, Was: #define ftruncate _chsize 
 #    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <io.h>
+#    include <windows.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 using std::string;
@@ -64,7 +74,9 @@ ChunkedFile::ChunkedFile() :
     offset_(0),
     compressed_in_(0),
     unused_(NULL),
-    nUnused_(0)
+    nUnused_(0),
+    mapped_(NULL),
+    mapped_size_(0)
 {
     stream_factory_ = std::make_shared<StreamFactory>(this);
 }
@@ -75,7 +87,7 @@ ChunkedFile::~ChunkedFile() {
 
 void ChunkedFile::openReadWrite(string const& filename) { open(filename, "r+b"); }
 void ChunkedFile::openWrite    (string const& filename) { open(filename, "w+b");  }
-void ChunkedFile::openRead     (string const& filename) { open(filename, "rb");  }
+void ChunkedFile::openRead     (string const& filename) { open(filename, "rb"); map(); }
 
 void ChunkedFile::open(string const& filename, string const& mode) {
     // Check if file is already open
@@ -137,6 +149,8 @@ void ChunkedFile::close() {
     // Close any compressed stream by changing to uncompressed mode
     setWriteMode(compression::Uncompressed);
 
+    unmap();
+
     // Close the file
     int success = fclose(file_);
     if (success != 0)
@@ -216,6 +230,69 @@ void ChunkedFile::decompress(CompressionType compression, uint8_t* dest, unsigne
     stream_factory_->getStream(compression)->decompress(dest, dest_len, source, source_len);
 }
 
+uint8_t const* ChunkedFile::getMapped(uint64_t offset, uint64_t size) const {
+    if (!mapped_ || offset > mapped_size_ || size > mapped_size_ - offset)
+        return NULL;
+#ifndef _WIN32
+    // Touching a page past the end of a file truncated since it was mapped raises SIGBUS: such bytes are read instead,
+    // which fails gracefully. (A mapped file cannot be truncated on Windows.)
+    struct stat st;
+    if (fstat(fileno(file_), &st) != 0 || uint64_t(st.st_size) < offset + size)
+        return NULL;
+#endif
+    return mapped_ + offset;
+}
+
+// Failing to map is not an error: the file is then read as usual
+void ChunkedFile::map() {
+    int64_t size = 0;
+#ifdef _WIN32
+    HANDLE file = (HANDLE) _get_osfhandle(fileno(file_));
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size))
+        return;
+    size = file_size.QuadPart;
+    if (size <= 0 || uint64_t(size) > SIZE_MAX)
+        return;
+    HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        return;
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);  // the view keeps the mapping open
+    if (!view)
+        return;
+#else
+    struct stat st;
+    if (fstat(fileno(file_), &st) != 0)
+        return;
+    size = st.st_size;
+    if (size <= 0 || uint64_t(size) > SIZE_MAX)
+        return;
+    // Private: nothing written to the mapped bytes could ever reach the file
+    void* view = mmap(NULL, size_t(size), PROT_READ, MAP_PRIVATE, fileno(file_), 0);
+    if (view == MAP_FAILED)
+        return;
+    // Bags are mostly played from start to end
+    posix_madvise(view, size_t(size), POSIX_MADV_SEQUENTIAL);
+#endif
+    mapped_ = static_cast<uint8_t const*>(view);
+    mapped_size_ = uint64_t(size);
+#ifdef _WIN32
+    mapping_ = std::shared_ptr<void const>(view, [](void const* view) { UnmapViewOfFile(view); });
+#else
+    mapping_ = std::shared_ptr<void const>(view, [size](void const* view) { munmap(const_cast<void*>(view), size_t(size)); });
+#endif
+}
+
+void ChunkedFile::unmap() {
+    if (!mapped_)
+        return;
+    // Unmapped once the last frame whose data is in the mapping is released, too
+    mapping_.reset();
+    mapped_ = NULL;
+    mapped_size_ = 0;
+}
+
 void ChunkedFile::clearUnused() {
     unused_ = NULL;
     nUnused_ = 0;
@@ -62,4 +62,12 @@ uint32_t MessageInstance::size() const {
     return bag_->readMessageDataSize(index_entry_);
 }
 
+uint32_t MessageInstance::readPrefix(uint8_t* buffer, uint32_t size) const {
+    return bag_->readMessageDataPrefix(index_entry_, buffer, size);
+}
+
+bool MessageInstance::getMappedData(uint8_t const*& data, uint32_t& size, std::shared_ptr<void const>& mapping) const {
+    return bag_->getMappedMessageData(index_entry_, data, size, mapping);
+}
+
 } // namespace rosbag
@@ -22,6 +22,7 @@ class single_consumer_queue
 
     unsigned int const _cap;
     bool _accepting;
+    bool _conflating = false;
 
     std::function<void(T const &)> const _on_drop_callback;
 
@@ -36,6 +37,7 @@ public:
 
     // Enqueue an item onto the queue.
     // If the queue grows beyond capacity, the front will be removed, losing whatever was there!
+    // When conflating, everything already queued is superseded by the new item and removed.
     bool enqueue(T&& item)
     {
         std::unique_lock<std::mutex> lock(_mutex);
@@ -46,6 +48,16 @@ public:
             return false;
         }
 
+        if( _conflating )
+        {
+            while( ! _queue.empty() )
+            {
+                if( _on_drop_callback )
+                    _on_drop_callback( _queue.front() );
+                _queue.pop_front();
+            }
+        }
+
         _queue.push_back(std::move(item));
 
         if( _queue.size() > _cap )
@@ -181,6 +193,20 @@ public:
         _accepting = true;
     }
 
+    // A conflating queue holds only the latest item, so the consumer never gets stale ones. Blocking enqueues are
+    // unaffected.
+    void set_conflating( bool conflating )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _conflating = conflating;
+    }
+
+    bool conflating() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _conflating;
+    }
+
     bool started() const { return _accepting; }
     bool stopped() const { return ! started(); }
 
@@ -190,6 +216,8 @@ public:
         return _queue.size();
     }
 
+    size_t capacity() const { return _cap; }
+
     bool empty() const { return ! size(); }
 };
 
@@ -251,11 +279,26 @@ public:
         _queue.start();
     }
 
+    void set_conflating( bool conflating )
+    {
+        _queue.set_conflating( conflating );
+    }
+
+    bool conflating() const
+    {
+        return _queue.conflating();
+    }
+
     size_t size() const
     {
         return _queue.size();
     }
 
+    size_t capacity() const
+    {
+        return _queue.capacity();
+    }
+
     bool empty() const
     {
         return _queue.empty();
@@ -0,0 +1,42 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# test:device D400*
+
+import pyrealsense2 as rs
+from rspy import test, log
+import json
+
+dev = test.find_first_device_or_exit()
+serial = dev.get_info( rs.camera_info.serial_number )
+
+
+def start_and_get_report():
+    pipe = rs.pipeline()
+    cfg = rs.config()
+    cfg.enable_device( serial )
+    cfg.enable_stream( rs.stream.depth )
+    cfg.enable_stream( rs.stream.color )
+    pipe.start( cfg )
+    pipe.wait_for_frames()
+    report = json.loads( pipe.get_start_report() )
+    log.d( report )
+    pipe.stop()
+    return report
+
+
+################################################################################################
+with test.closure( "Start-up timing is reported" ):
+    report = start_and_get_report()
+    test.check( report['total-ms'] >= report['resolve-ms'] + report['open-ms'] )
+    test.check( len( report['sensors'] ) >= 2 )
+    for sensor in report['sensors']:
+        test.check( sensor['open-ms'] <= report['open-ms'] )
+
+################################################################################################
+with test.closure( "A second start with the same configuration reuses the resolution" ):
+    report = start_and_get_report()
+    test.check( report['resolved-from-cache'] )
+
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,76 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+from rspy import log, test
+import pyrealsense2 as rs
+
+
+W = 64
+H = 48
+BPP = 2
+
+sd = rs.software_device()
+sensor = sd.add_sensor( "software_sensor" )
+vs = rs.video_stream()
+vs.type = rs.stream.depth
+vs.uid = 0
+vs.width = W
+vs.height = H
+vs.fps = 30
+vs.bpp = BPP
+vs.fmt = rs.format.z16
+profile = rs.video_stream_profile( sensor.add_video_stream( vs ))
+# Frames are held by the queue, so once two are published each new frame logs a per-frame debug message
+sensor.set_option( rs.option.frames_queue_size, 2 )
+queue = rs.frame_queue( 10 )
+sensor.open( profile )
+sensor.start( queue )
+
+
+def generate_frames( n ):
+    for i in range( n ):
+        frame = rs.software_video_frame()
+        frame.pixels = bytearray( b'\x00' * ( W * H * BPP ))
+        frame.stride = W * BPP
+        frame.bpp = BPP
+        frame.frame_number = i
+        frame.timestamp = i * 33.
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.profile = profile
+        sensor.on_video_frame( frame )
+
+
+not_released = []
+def on_log( severity, message ):
+    if "User didn't release frame resource" in message.raw():
+        log.d( message.full() )
+        not_released.append( message.raw() )
+
+
+rs.log_to_callback( rs.log_severity.debug, on_log )
+
+
+#############################################################################################
+#
+with test.closure( "Messages are logged synchronously by default" ):
+    generate_frames( 5 )
+    test.check_equal( len( not_released ), 3 )
+#
+#############################################################################################
+#
+with test.closure( "Asynchronous messages are all written out when disabling" ):
+    not_released.clear()
+    rs.enable_async_logging( True )
+    generate_frames( 5 )
+    rs.enable_async_logging( False )
+    test.check_equal( len( not_released ), 5 )
+    # Prefixed with the logging thread ID
+    for message in not_released:
+        test.check( message.startswith( '[' ))
+#
+#############################################################################################
+
+sensor.stop()
+sensor.close()
+rs.reset_logger()
+test.print_results_and_exit()
@@ -0,0 +1,93 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+from rspy import log, test
+import pyrealsense2 as rs
+
+import json, tempfile, os.path, subprocess, sys
+trace_filename = os.path.join( tempfile.gettempdir(), 'lrs-trace.json' )
+
+
+W = 64
+H = 48
+BPP = 2
+
+sd = rs.software_device()
+sensor = sd.add_sensor( "software_sensor" )
+vs = rs.video_stream()
+vs.type = rs.stream.depth
+vs.uid = 0
+vs.width = W
+vs.height = H
+vs.fps = 30
+vs.bpp = BPP
+vs.fmt = rs.format.z16
+profile = rs.video_stream_profile( sensor.add_video_stream( vs ))
+queue = rs.frame_queue( 10 )
+sensor.open( profile )
+sensor.start( queue )
+
+
+def get_depth_frame( n ):
+    frame = rs.software_video_frame()
+    frame.pixels = bytearray( b'\x00' * ( W * H * BPP ))
+    frame.stride = W * BPP
+    frame.bpp = BPP
+    frame.frame_number = n
+    frame.timestamp = n * 33.
+    frame.domain = rs.timestamp_domain.hardware_clock
+    frame.profile = profile
+    sensor.on_video_frame( frame )
+    return queue.wait_for_frame()
+
+
+def process_frames( n ):
+    decimation = rs.decimation_filter()
+    for i in range( n ):
+        decimation.process( get_depth_frame( i ))
+
+
+def load_trace():
+    with open( trace_filename ) as f:
+        events = json.load( f )
+    log.d( len( events ), 'events' )
+    return events
+
+
+#############################################################################################
+#
+with test.closure( "Processing blocks are traced" ):
+    rs.start_trace( trace_filename )
+    process_frames( 5 )
+    rs.stop_trace()
+    events = load_trace()
+    decimations = [e for e in events if e['name'] == 'Decimation Filter']
+    test.check_equal( len( decimations ), 5 )
+    for e in decimations:
+        test.check_equal( e['ph'], 'X' )
+        test.check( e['dur'] >= 0 )
+#
+#############################################################################################
+#
+with test.closure( "Nothing is traced once stopped" ):
+    process_frames( 5 )
+    test.check_equal( len( [e for e in load_trace() if e['name'] == 'Decimation Filter'] ), 5 )
+#
+#############################################################################################
+#
+with test.closure( "LRS_TRACE_FILE traces the process once the library is used" ):
+    env = dict( os.environ )
+    env['LRS_TRACE_FILE'] = trace_filename
+    env['PYTHONPATH'] = os.pathsep.join( sys.path )
+    os.remove( trace_filename )
+    # Loading the library alone does not start the trace
+    subprocess.run( [sys.executable, '-c', 'import pyrealsense2'], env=env, check=True )
+    test.check_false( os.path.exists( trace_filename ))
+    subprocess.run( [sys.executable, '-c', 'import pyrealsense2 as rs; rs.context()'], env=env, check=True )
+    test.check( isinstance( load_trace(), list ))  # ended properly on unload
+#
+#############################################################################################
+
+sensor.stop()
+sensor.close()
+test.print_results_and_exit()
@@ -0,0 +1,58 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+
+
+BPP = 2  # Z16
+
+
+class depth_source:
+    """
+    A software depth sensor, started, to feed processing blocks with: frame(n) generates frame number n and returns it
+    as it comes out of the sensor
+    """
+    def __init__( self, width, height, pixels = None, intrinsics = None, queue_size = 1 ):
+        self.width = width
+        self.height = height
+        self.pixels = pixels  # default for frame()
+
+        self._device = rs.software_device()
+        self._sensor = self._device.add_sensor( "software_sensor" )
+        self._sensor.add_read_only_option( rs.option.depth_units, 0.001 )
+
+        vs = rs.video_stream()
+        vs.type = rs.stream.depth
+        vs.index = 0
+        vs.uid = 0
+        vs.width = width
+        vs.height = height
+        vs.fps = 30
+        vs.bpp = BPP
+        vs.fmt = rs.format.z16
+        if intrinsics is not None:
+            vs.intrinsics = intrinsics
+        self._sensor.add_video_stream( vs )
+
+        profiles = self._sensor.get_stream_profiles()
+        self.profile = profiles[0].as_video_stream_profile()
+
+        self._queue = rs.frame_queue( queue_size )
+        self._sensor.open( profiles )
+        self._sensor.start( self._queue )
+
+    def frame( self, n, pixels = None ):
+        frame = rs.software_video_frame()
+        frame.pixels = self.pixels if pixels is None else pixels
+        frame.bpp = BPP
+        frame.stride = BPP * self.width
+        frame.timestamp = float( n * 33 )
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.frame_number = n
+        frame.profile = self.profile
+        self._sensor.on_video_frame( frame )
+        return self._queue.wait_for_frame()
+
+    def stop( self ):
+        self._sensor.stop()
+        self._sensor.close()
@@ -0,0 +1,69 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+from depth_source import depth_source
+
+################################################################################################
+W = 160
+H = 120
+N = 12
+N_LARGE = 64  # more than the frames a block may have published at a time
+
+source = depth_source( W, H, queue_size = N_LARGE )
+
+
+def get_depth_frame( n ):
+    # Every frame is different, so that the temporal filter state depends on the frame order
+    return source.frame( n, np.array( [1000 + ( i * ( n + 1 )) % 500 for i in range( W * H )], dtype=np.uint16 ))
+
+
+def as_array( frame ):
+    return np.asarray( frame.get_data(), dtype=np.uint16 ).copy()
+
+
+################################################################################################
+with test.closure( "Batch processing matches frame-by-frame processing" ):
+    temporal = rs.temporal_filter()
+    spatial = rs.spatial_filter()
+    expected = [as_array( spatial.process( temporal.process( get_depth_frame( n ))))
+                for n in range( N )]
+
+    temporal = rs.temporal_filter()
+    spatial = rs.spatial_filter()
+    results = rs.processing_block.process_batch( [temporal, spatial], [get_depth_frame( n ) for n in range( N )] )
+    test.check_equal( len( results ), N )
+    for n in range( N ):
+        test.check( np.array_equal( as_array( results[n] ), expected[n] ))
+        test.check_equal( results[n].get_frame_number(), n )
+
+################################################################################################
+with test.closure( "A batch larger than the frames a block may publish at a time" ):
+    temporal = rs.temporal_filter()
+    spatial = rs.spatial_filter()
+    expected = [as_array( spatial.process( temporal.process( get_depth_frame( n ))))
+                for n in range( N_LARGE )]
+
+    temporal = rs.temporal_filter()
+    spatial = rs.spatial_filter()
+    frames = []
+    for n in range( N_LARGE ):
+        f = get_depth_frame( n )
+        f.keep()  # or the sensor runs out of frames before the batch is complete
+        frames.append( f )
+    results = rs.processing_block.process_batch( [temporal, spatial], frames )
+    test.check_equal( len( results ), N_LARGE )
+    for n in range( N_LARGE ):
+        test.check( results[n] )
+        test.check( np.array_equal( as_array( results[n] ), expected[n] ))
+        test.check_equal( results[n].get_frame_number(), n )
+
+################################################################################################
+with test.closure( "Blocks are usable one frame at a time after a batch" ):
+    out = spatial.process( get_depth_frame( N ))
+    test.check( out )
+
+source.stop()
+test.print_results_and_exit()
@@ -0,0 +1,123 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+from depth_source import depth_source
+
+################################################################################################
+W = 640
+H = 480
+ROI = ( 100, 320, 540, 480 )   # min x, min y, max x, max y -- the lower third of the image
+
+intrinsics = rs.intrinsics()
+intrinsics.width = W
+intrinsics.height = H
+intrinsics.ppx = W / 2
+intrinsics.ppy = H / 2
+intrinsics.fx = 400
+intrinsics.fy = 400
+intrinsics.model = rs.distortion.none
+intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+pixels = np.array( [1000 + (i % 10) for i in range( W * H )], dtype=np.uint16 )
+source = depth_source( W, H, pixels, intrinsics )
+get_depth_frame = source.frame
+
+
+def set_roi( block ):
+    block.set_option( rs.option.filter_roi_min_x, ROI[0] )
+    block.set_option( rs.option.filter_roi_min_y, ROI[1] )
+    block.set_option( rs.option.filter_roi_max_x, ROI[2] )
+    block.set_option( rs.option.filter_roi_max_y, ROI[3] )
+
+
+def as_image( frame, width, height, dtype=np.uint16 ):
+    return np.asarray( frame.get_data(), dtype=dtype ).reshape( height, width )
+
+
+def check_roi( out, expected, roi ):
+    """
+    The region of interest must match the expected pixels exactly, and everything else must be invalid (zero)
+    """
+    x0, y0, x1, y1 = roi
+    test.check( np.array_equal( out[y0:y1, x0:x1], expected[y0:y1, x0:x1] ))
+    outside = np.ones( out.shape, dtype=bool )
+    outside[y0:y1, x0:x1] = False
+    test.check_equal( np.count_nonzero( out[outside] ), 0 )
+
+
+################################################################################################
+with test.closure( "Temporal filter restricted to a region of interest" ):
+    temporal = rs.temporal_filter()
+    set_roi( temporal )
+    out = as_image( temporal.process( get_depth_frame( 1 )), W, H )
+    check_roi( out, pixels.reshape( H, W ), ROI )
+
+################################################################################################
+with test.closure( "Spatial filter invalidates pixels outside the region of interest" ):
+    # With a halo reaching the frame edges, the region sees the same context as a full-frame pass
+    halo = 64
+    roi = ( halo, halo, W - halo, H - halo )
+    spatial = rs.spatial_filter()
+    spatial.set_option( rs.option.filter_roi_min_x, roi[0] )
+    spatial.set_option( rs.option.filter_roi_min_y, roi[1] )
+    spatial.set_option( rs.option.filter_roi_max_x, roi[2] )
+    spatial.set_option( rs.option.filter_roi_max_y, roi[3] )
+    spatial.set_option( rs.option.filter_roi_halo, halo )
+    frame = get_depth_frame( 2 )
+    out = as_image( spatial.process( frame ), W, H )
+    expected = as_image( rs.spatial_filter().process( frame ), W, H )
+    test.check( not np.array_equal( expected, pixels.reshape( H, W )))  # the filter did smooth something
+    check_roi( out, expected, roi )
+
+################################################################################################
+with test.closure( "Hole filling restricted to a region of interest" ):
+    # Holes in every row: on the left edge of the region, inside it, and outside of it
+    x0, y0, x1, y1 = ROI
+    image = pixels.reshape( H, W ).copy()
+    for x in ( x0 - 20, x0, x0 + 10, x1 + 10 ):
+        image[:, x] = 0
+    holes = image.reshape( -1 )
+    # Filling from the left takes the pixel to the left of each hole
+    filled = image.copy()
+    for x in ( x0, x0 + 10 ):
+        filled[:, x] = image[:, x - 1]
+
+    hole_filling = rs.hole_filling_filter( 0 )  # fill_from_left
+    set_roi( hole_filling )
+    hole_filling.set_option( rs.option.filter_roi_halo, 1 )
+    out = as_image( hole_filling.process( get_depth_frame( 3, holes )), W, H )
+    check_roi( out, filled, ROI )
+
+    # Without a halo there is nothing to the left of the region to fill from
+    hole_filling.set_option( rs.option.filter_roi_halo, 0 )
+    out = as_image( hole_filling.process( get_depth_frame( 4, holes )), W, H )
+    filled[:, x0] = 0
+    check_roi( out, filled, ROI )
+
+################################################################################################
+with test.closure( "Decimation filter produces only the decimated region of interest" ):
+    decimation = rs.decimation_filter( 2 )
+    set_roi( decimation )
+    frame = get_depth_frame( 5 )
+    out = decimation.process( frame ).as_video_frame()
+    full = rs.decimation_filter( 2 ).process( frame ).as_video_frame()
+    test.check_equal( ( out.get_width(), out.get_height() ), ( full.get_width(), full.get_height() ))
+    img = as_image( out, out.get_width(), out.get_height() )
+    expected = as_image( full, full.get_width(), full.get_height() )
+    check_roi( img, expected, tuple( v // 2 for v in ROI ))
+
+################################################################################################
+with test.closure( "Pointcloud deprojects only the region of interest" ):
+    pc = rs.pointcloud()
+    set_roi( pc )
+    points = pc.calculate( get_depth_frame( 6 ))
+    vertices = np.asarray( points.get_vertices( 2 )).reshape( H, W, 3 )
+    x0, y0, x1, y1 = ROI
+    test.check( np.count_nonzero( vertices[y0:y1, x0:x1, 2] ) == ( y1 - y0 ) * ( x1 - x0 ))
+    test.check_equal( np.count_nonzero( vertices[:y0, :, 2] ), 0 )
+
+source.stop()
+test.print_results_and_exit()
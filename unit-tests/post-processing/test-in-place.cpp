@@ -0,0 +1,81 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../catch.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <vector>
+#include <cstdint>
+
+using namespace rs2;
+
+static const int W = 64;
+static const int H = 48;
+static const float DEPTH_UNITS = 0.001f;
+static const uint16_t MAX_DEPTH = 1000;  // 1m, the threshold filter's max
+
+
+// A threshold filter, handed each frame exclusively, can write its output over the frame
+static threshold_filter make_threshold()
+{
+    threshold_filter threshold;
+    threshold.set_option( RS2_OPTION_MIN_DISTANCE, 0.f );
+    threshold.set_option( RS2_OPTION_MAX_DISTANCE, MAX_DEPTH * DEPTH_UNITS );
+    return threshold;
+}
+
+
+TEST_CASE( "Borrowed frames are not processed in place", "[software-device][post-processing-filters]" )
+{
+    software_device dev;
+    auto depth_sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intrinsics = { W, H, W / 2.f, H / 2.f, W, H, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    auto profile = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+    depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, DEPTH_UNITS );
+
+    // Half the pixels are beyond the threshold
+    std::vector< uint16_t > pixels( W * H );
+    for( size_t i = 0; i < pixels.size(); ++i )
+        pixels[i] = uint16_t( ( i % 2 ) ? MAX_DEPTH * 2 : MAX_DEPTH / 2 );
+    auto const original = pixels;
+
+    auto threshold = make_threshold();
+    auto second = make_threshold();
+    frame_queue output( 1, true );
+    void const * threshold_data = nullptr;  // Where the first threshold put its output
+    second.start( output );
+    threshold.start( [&]( frame f ) {
+        threshold_data = f.get_data();
+        second.invoke( std::move( f ) );
+    } );
+
+    depth_sensor.open( profile );
+    depth_sensor.start( [&]( frame f ) { threshold.invoke( std::move( f ) ); } );
+    depth_sensor.on_video_frame( { pixels.data(),
+                                   []( void * ) {},
+                                   W * 2,
+                                   2,
+                                   0.,
+                                   RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                   1,
+                                   profile,
+                                   DEPTH_UNITS } );
+
+    frame f;
+    REQUIRE( output.try_wait_for_frame( &f ) );
+    depth_sensor.stop();
+    depth_sensor.close();
+
+    // The output is as expected...
+    auto data = reinterpret_cast< uint16_t const * >( f.get_data() );
+    for( size_t i = 0; i < pixels.size(); ++i )
+        REQUIRE( data[i] == ( ( i % 2 ) ? 0 : MAX_DEPTH / 2 ) );
+
+    // ... while the caller's buffer the sensor frame pointed at is untouched
+    CHECK( f.get_data() != pixels.data() );
+    CHECK( pixels == original );
+
+    // The first threshold's output, which it owns, was handed over to the second and processed in place
+    CHECK( f.get_data() == threshold_data );
+}
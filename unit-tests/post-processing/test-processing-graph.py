@@ -0,0 +1,90 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+import json
+from depth_source import depth_source
+
+################################################################################################
+W = 320
+H = 240
+
+pixels = np.array( [1000 + i % 3000 for i in range( W * H )], dtype=np.uint16 )
+source = depth_source( W, H, pixels, queue_size = 2 )
+get_depth_frame = source.frame
+
+
+################################################################################################
+with test.closure( "Independent branches are combined into one frameset" ):
+    graph = rs.processing_graph( json.dumps( {
+        "nodes": [
+            { "name": "decimated", "block": "Decimation Filter", "inputs": ["depth"], "options": { "Filter Magnitude": 4 } },
+            { "name": "thresholded", "block": "Threshold Filter", "inputs": ["decimated"] },
+            { "name": "colorized", "block": "colorizer", "inputs": ["depth"] }
+        ],
+        "outputs": ["thresholded", "colorized"]
+    } ))
+    result = graph.process( get_depth_frame( 1 ))
+    test.check( result.is_frameset() )
+    fs = result.as_frameset()
+    test.check_equal( fs.size(), 2 )
+    formats = sorted( [str( f.get_profile().format() ) for f in fs] )
+    test.check_equal( formats, ['format.rgb8', 'format.z16'] )
+    for f in fs:
+        if f.get_profile().format() == rs.format.z16:
+            test.check( f.as_video_frame().get_width() < W )
+
+################################################################################################
+with test.closure( "Framesets produced by nodes are flattened" ):
+    # A filter given two inputs processes each of them, and outputs both as a frameset
+    graph = rs.processing_graph( json.dumps( {
+        "nodes": [
+            { "name": "decimated", "block": "Decimation Filter", "inputs": ["depth"] },
+            { "name": "both", "block": "Threshold Filter", "inputs": ["depth", "decimated"] },
+            { "name": "colorized", "block": "colorizer", "inputs": ["both"] },
+            { "name": "all", "block": "Threshold Filter", "inputs": ["both", "colorized"] }
+        ],
+        "outputs": ["all", "both"]
+    } ))
+    fs = graph.process( get_depth_frame( 1 )).as_frameset()
+    test.check( not any( f.is_frameset() for f in fs ))
+    formats = set( f.get_profile().format() for f in fs )
+    test.check_equal( formats, { rs.format.z16, rs.format.rgb8 } )
+
+################################################################################################
+with test.closure( "A level of parallel nodes matches the blocks run one by one" ):
+    graph = rs.processing_graph( json.dumps( {
+        "nodes": [
+            { "name": "decimated", "block": "Decimation Filter", "inputs": ["depth"], "options": { "Filter Magnitude": 2 } },
+            { "name": "thresholded", "block": "Threshold Filter", "inputs": ["depth"], "options": { "Max Distance": 2 } },
+            { "name": "spatial", "block": "Spatial Filter", "inputs": ["depth"] },
+            { "name": "filled", "block": "Hole Filling Filter", "inputs": ["depth"] }
+        ],
+        "outputs": ["decimated", "thresholded", "spatial", "filled"]
+    } ))
+    decimation = rs.decimation_filter()
+    decimation.set_option( rs.option.filter_magnitude, 2 )
+    threshold = rs.threshold_filter()
+    threshold.set_option( rs.option.max_distance, 2 )
+    blocks = [decimation, threshold, rs.spatial_filter(), rs.hole_filling_filter()]
+    for n in range( 20 ):
+        depth = get_depth_frame( n )
+        expected = [np.asarray( b.process( depth ).get_data() ).copy() for b in blocks]
+        fs = graph.process( depth ).as_frameset()
+        test.check_equal( fs.size(), len( blocks ))
+        for f, e in zip( fs, expected ):
+            test.check( np.array_equal( np.asarray( f.get_data() ), e ))
+
+################################################################################################
+with test.closure( "Invalid graphs are rejected" ):
+    cycle = { "nodes": [ { "name": "a", "block": "Spatial Filter", "inputs": ["b"] },
+                         { "name": "b", "block": "Temporal Filter", "inputs": ["a"] } ],
+              "outputs": ["b"] }
+    test.check_throws( lambda: rs.processing_graph( json.dumps( cycle )), RuntimeError )
+    unknown = { "nodes": [ { "name": "a", "block": "No Such Filter", "inputs": ["depth"] } ], "outputs": ["a"] }
+    test.check_throws( lambda: rs.processing_graph( json.dumps( unknown )), RuntimeError )
+
+source.stop()
+test.print_results_and_exit()
@@ -0,0 +1,68 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+from depth_source import depth_source
+
+################################################################################################
+W = 320
+H = 240
+
+pixels = np.array( [i % 4000 for i in range( W * H )], dtype=np.uint16 )
+source = depth_source( W, H, pixels, queue_size = 2 )
+get_depth_frame = source.frame
+
+
+def data_address( frame ):
+    return np.asarray( frame.get_data() ).__array_interface__['data'][0]
+
+
+################################################################################################
+with test.closure( "Without a cache, every call produces a new frame" ):
+    colorizer = rs.colorizer()
+    test.check_equal( colorizer.get_option( rs.option.result_cache_size ), 0 )
+    depth = get_depth_frame( 1 )
+    first = colorizer.process( depth )
+    second = colorizer.process( depth )
+    test.check( data_address( first ) != data_address( second ))
+
+################################################################################################
+with test.closure( "Repeated processing of the same frame is served from the cache" ):
+    colorizer = rs.colorizer()
+    colorizer.set_option( rs.option.result_cache_size, 2 )
+    depth = get_depth_frame( 2 )
+    first = colorizer.process( depth )
+    second = colorizer.process( depth )
+    test.check_equal( data_address( first ), data_address( second ))
+
+################################################################################################
+with test.closure( "Changing an option invalidates cached results" ):
+    colorizer.set_option( rs.option.color_scheme, 2 )
+    third = colorizer.process( depth )
+    test.check( data_address( third ) != data_address( first ))
+
+################################################################################################
+with test.closure( "A new input frame is not matched against older results" ):
+    other = colorizer.process( get_depth_frame( 3 ))
+    test.check( data_address( other ) != data_address( third ))
+
+################################################################################################
+with test.closure( "Changing an option again is noticed as well" ):
+    colorizer.set_option( rs.option.color_scheme, 0 )
+    fourth = colorizer.process( depth )
+    test.check( data_address( fourth ) != data_address( third ))
+    test.check_equal( data_address( colorizer.process( depth )), data_address( fourth ))
+
+################################################################################################
+with test.closure( "Results that depend on earlier frames are not cached" ):
+    temporal = rs.temporal_filter()
+    temporal.set_option( rs.option.result_cache_size, 2 )
+    depth = get_depth_frame( 4 )
+    first = temporal.process( depth )
+    second = temporal.process( depth )
+    test.check( data_address( first ) != data_address( second ))
+
+source.stop()
+test.print_results_and_exit()
@@ -148,3 +148,27 @@ TEST_CASE("verify mutex protection")
     enqueue_thread1.join();
     enqueue_thread2.join();
 }
+
+TEST_CASE( "conflating keeps only the latest item" )
+{
+    std::vector< int > dropped;
+    single_consumer_queue< int > scq( 10, [&]( int const & i ) { dropped.push_back( i ); } );
+    scq.set_conflating( true );
+    REQUIRE( scq.conflating() );
+
+    for( int i = 0; i < 5; ++i )
+        scq.enqueue( std::move( i ) );
+    REQUIRE( scq.size() == 1 );
+    REQUIRE( dropped == std::vector< int >( { 0, 1, 2, 3 } ) );
+
+    int val;
+    REQUIRE( scq.try_dequeue( &val ) );
+    REQUIRE( val == 4 );
+    REQUIRE( scq.empty() );
+
+    // Back to regular queueing
+    scq.set_conflating( false );
+    scq.enqueue( 5 );
+    scq.enqueue( 6 );
+    REQUIRE( scq.size() == 2 );
+}
@@ -3,7 +3,7 @@
 
 import pyrealsense2 as rs
 from rspy import log, test
-from time import time
+from time import time, sleep
 
 
 fps = 30
@@ -124,3 +124,108 @@ class video_stream:
         f.domain = domain
         f.profile = self._profile
         return f
+
+
+###############################################################################################
+# Recording: a software device whose frames are sent as needed, recorded, and the recording played back
+#
+
+class recording_device:
+    """
+    A software device with video streams, each on a sensor of a given name; record() starts the sensors, and frames
+    are sent to the streams with send()
+    """
+    def __init__( self ):
+        self.handle = rs.software_device()
+        self._sensors = {}  # name -> ( sensor, [profiles] )
+        self._streams = {}  # profile unique id -> ( sensor, bpp )
+
+    def sensor( self, name ):
+        """
+        The sensor of the given name, added if not there yet
+        """
+        if name not in self._sensors:
+            self._sensors[name] = ( self.handle.add_sensor( name ), [] )
+        return self._sensors[name][0]
+
+    def add_video_stream( self, sensor_name = "Depth", type = rs.stream.depth, format = rs.format.z16, bpp = 2,
+                          width = w, height = h, fps = fps ):
+        sensor = self.sensor( sensor_name )
+        vs = rs.video_stream()
+        vs.type = type
+        vs.uid = len( self._streams )
+        vs.width = width
+        vs.height = height
+        vs.fps = fps
+        vs.bpp = bpp
+        vs.fmt = format
+        profile = rs.video_stream_profile( sensor.add_video_stream( vs ))
+        self._sensors[sensor_name][1].append( profile )
+        self._streams[profile.unique_id()] = ( sensor, bpp )
+        return profile
+
+    def send( self, profile, pixels, frame_number, timestamp = None ):
+        """
+        Sends a frame of the stream; by default its timestamp is that of its frame number (from 1) at the stream's fps
+        """
+        sensor, bpp = self._streams[profile.unique_id()]
+        frame = rs.software_video_frame()
+        frame.pixels = pixels
+        frame.stride = profile.width() * bpp
+        frame.bpp = bpp
+        frame.frame_number = frame_number
+        frame.timestamp = ( frame_number - 1 ) * 1000. / profile.fps() if timestamp is None else timestamp
+        frame.domain = domain
+        frame.profile = profile
+        sensor.on_video_frame( frame )
+
+    def record( self, filename, settings, generate, sensors = None ):
+        """
+        Records to the file with the given recorder settings: the sensors (by name; all by default) are started,
+        generate( recorder ) sends the frames, then the sensors are stopped and the recording closed. Returns what
+        generate returned.
+        """
+        recorder = rs.recorder( filename, self.handle, settings )
+        started = [self._sensors[name] for name in ( sensors or self._sensors )]
+        for sensor, profiles in started:
+            sensor.open( profiles )
+            sensor.start( lambda f: None )
+        try:
+            return generate( recorder )
+        finally:
+            for sensor, profiles in started:
+                sensor.stop()
+                sensor.close()
+            del recorder
+
+
+def load( filename, ctx = None ):
+    """
+    A recording, loaded to be played as fast as it can be read
+    """
+    player = ( ctx or rs.context() ).load_device( filename )
+    player.set_real_time( False )
+    return player
+
+
+def play( player, on_frame = None ):
+    """
+    Plays a recording (a player, or the file name to load) through, with all the streams of its first sensor, calling
+    on_frame( f ) for every frame if given; returns the frame numbers played
+    """
+    if isinstance( player, str ):
+        player = load( player )
+    playback = player.as_playback()
+    sensor = player.query_sensors()[0]
+    numbers = []
+    def callback( f ):
+        numbers.append( f.get_frame_number() )
+        if on_frame:
+            on_frame( f )
+    sensor.open( sensor.get_stream_profiles() )
+    sensor.start( callback )
+    while playback.current_status() != rs.playback_status.stopped:
+        sleep( 0.1 )
+    sensor.stop()
+    sensor.close()
+    return numbers
@@ -113,6 +113,55 @@ test.finish()
 #
 #############################################################################################
 #
+test.start( "Recycled frames do not keep decoded metadata" )
+try:
+    with sw.sensor( "Stereo Module" ) as sensor:
+        depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+        sensor.start( depth )
+
+        sensor.set( rs.frame_metadata_value.white_balance, 0xbaad )
+        f = sensor.publish( depth.frame() )
+        # Querying twice: the second comes from the frame's decoded values
+        test.check_equal( f.get_frame_metadata( rs.frame_metadata_value.white_balance ), 0xbaad )
+        test.check_equal( f.get_frame_metadata( rs.frame_metadata_value.white_balance ), 0xbaad )
+        test.check_false( f.supports_frame_metadata( rs.frame_metadata_value.actual_fps ))
+        del f  # its memory is now free to be reused by the next frame
+
+        sensor.set( rs.frame_metadata_value.white_balance, 0xf00d )
+        sensor.set( rs.frame_metadata_value.actual_fps, 0x1eaf )
+        f = sensor.publish( depth.frame() )
+        test.check_equal( f.get_frame_metadata( rs.frame_metadata_value.white_balance ), 0xf00d )
+        test.check_equal( f.get_frame_metadata( rs.frame_metadata_value.actual_fps ), 0x1eaf )
+except:
+    test.unexpected_exception()
+test.finish()
+#
+#############################################################################################
+#
+test.start( "All values at once" )
+try:
+    with sw.sensor( "Stereo Module" ) as sensor:
+        depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+        sensor.start( depth )
+
+        f = sensor.publish( depth.frame() )
+        test.check_equal( f.get_frame_metadata_values(), {} )
+
+        sensor.set( rs.frame_metadata_value.white_balance, 0xbaad )
+        sensor.set( rs.frame_metadata_value.actual_fps, 0xf00d )
+        f = sensor.publish( depth.frame() )
+        values = f.get_frame_metadata_values()
+        test.check_equal( values, {
+            rs.frame_metadata_value.white_balance: 0xbaad,
+            rs.frame_metadata_value.actual_fps: 0xf00d } )
+        for md in frame_metadata_values():
+            test.check_equal( md in values, f.supports_frame_metadata( md ))
+except:
+    test.unexpected_exception()
+test.finish()
+#
+#############################################################################################
+#
 test.start( "Multiple streams per sensor should share metadata" )
 try:
     with sw.sensor( "Stereo Module" ) as sensor:
@@ -0,0 +1,86 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# The index kept next to a recording (<file>.idx): written when recording, or on load when the context asks for it, and
+# ignored when it doesn't match the recording
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os, shutil
+import sw
+
+
+W = 640
+H = 480
+N_FRAMES = 30
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H )
+
+pixels = bytearray( W * H * 2 )
+
+
+def record( filename, settings, interval = 1000. / 30 ):
+    def generate( recorder ):
+        for i in range( N_FRAMES ):
+            # 4 digits, so the metadata is the same size for either interval
+            dev.send( profile, pixels, i + 1, timestamp = 1000 + i * interval )
+    dev.record( filename, settings, generate )
+
+
+def play( filename, ctx = None ):
+    return sw.play( sw.load( filename, ctx ))
+
+
+#############################################################################################
+#
+with test.closure( "Index written when recording" ):
+    filename = os.path.join( temp_dir.name, 'indexed.bag' )
+    record( filename, { 'index': True } )
+    test.check( os.path.exists( filename + '.idx' ))
+    test.check_equal( play( filename ), list( range( 1, N_FRAMES + 1 )))
+#
+#############################################################################################
+#
+with test.closure( "No index by default" ):
+    filename = os.path.join( temp_dir.name, 'plain.bag' )
+    record( filename, {} )
+    test.check( not os.path.exists( filename + '.idx' ))
+    test.check_equal( play( filename ), list( range( 1, N_FRAMES + 1 )))
+    test.check( not os.path.exists( filename + '.idx' ))
+#
+#############################################################################################
+#
+with test.closure( "Index written on load, if asked to" ):
+    test.check_equal( play( filename, rs.context( { 'playback-index': True } )), list( range( 1, N_FRAMES + 1 )))
+    test.check( os.path.exists( filename + '.idx' ))
+    test.check_equal( play( filename ), list( range( 1, N_FRAMES + 1 )))
+#
+#############################################################################################
+#
+with test.closure( "Index that doesn't match is ignored" ):
+    filename = os.path.join( temp_dir.name, 'indexed.bag' )
+    with open( filename + '.idx', 'r+b' ) as f:
+        f.seek( 24 )
+        f.write( b'\xff' * 64 )
+    test.check_equal( play( filename ), list( range( 1, N_FRAMES + 1 )))
+#
+#############################################################################################
+#
+with test.closure( "Index of another recording of the same size is ignored" ):
+    filename = os.path.join( temp_dir.name, 'indexed.bag' )
+    record( filename, { 'index': True } )
+    other = os.path.join( temp_dir.name, 'other.bag' )
+    record( other, {}, interval = 1000. / 31 )
+    test.check_equal( os.path.getsize( other ), os.path.getsize( filename ))
+    shutil.copyfile( filename + '.idx', other + '.idx' )
+    # The index is rebuilt, and rewritten, rather than used
+    test.check_equal( play( other, rs.context( { 'playback-index': True } )), list( range( 1, N_FRAMES + 1 )))
+    with open( filename + '.idx', 'rb' ) as f, open( other + '.idx', 'rb' ) as g:
+        test.check( f.read() != g.read() )
+#
+#############################################################################################
+
+test.print_results_and_exit()
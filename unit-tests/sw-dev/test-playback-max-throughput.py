@@ -0,0 +1,72 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# Plays back a compressed recording in max throughput mode (chunks decompressed ahead on all cores), reporting the
+# time it took, and checks every frame is intact
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os, time, threading
+import sw
+
+
+W = 1280
+H = 720
+N_FRAMES = 60
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+filename = os.path.join( temp_dir.name, 'rec.bag' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H )
+
+size = W * H * 2
+images = [bytearray(( bytes( range( 256 )) * ( size // 256 + 1 ))[i:i+size] ) for i in range( 2 )]
+
+def generate( recorder ):
+    for i in range( N_FRAMES ):
+        dev.send( profile, images[i % 2], i + 1 )
+
+dev.record( filename, True, generate )
+
+
+#############################################################################################
+#
+with test.closure( "Max throughput turns real time off" ):
+    ctx = rs.context()
+    player = ctx.load_device( filename )
+    playback = player.as_playback()
+    test.check( playback.is_real_time() )
+    test.check( not playback.is_max_throughput() )
+    playback.set_max_throughput( True )
+    test.check( playback.is_max_throughput() )
+    test.check( not playback.is_real_time() )
+#
+#############################################################################################
+#
+with test.closure( "Recording plays back intact" ):
+    mismatches = []
+    lock = threading.Lock()
+    def on_frame( f ):
+        global done
+        with lock:
+            if bytes( f.get_data() ) != bytes( images[( f.get_frame_number() - 1 ) % 2] ):
+                mismatches.append( f.get_frame_number() )
+            done = time.perf_counter()
+
+    start = done = time.perf_counter()  # done: when the last frame arrived
+    numbers = sw.play( player, on_frame )
+
+    log.i( f'{len( numbers )} {W}x{H} frames played back in {done - start:.2f} s' )
+    test.check_equal( sorted( numbers ), list( range( 1, N_FRAMES + 1 )))
+    test.check_equal( mismatches, [] )
+#
+#############################################################################################
+#
+with test.closure( "Real time turns max throughput off" ):
+    playback.set_real_time( True )
+    test.check( not playback.is_max_throughput() )
+#
+#############################################################################################
+
+test.print_results_and_exit()
@@ -0,0 +1,100 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# Frames read from a recording by number or time, without streaming, and playback not being affected by it
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os, time, datetime
+import sw
+
+
+W = 640
+H = 480
+N_FRAMES = 30
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H )
+
+
+def pixels( frame_number ):
+    return bytearray( [frame_number % 256] ) * ( W * H * 2 )
+
+
+def record( filename, settings ):
+    def generate( recorder ):
+        for i in range( N_FRAMES ):
+            dev.send( profile, pixels( i + 1 ), i + 1 )
+            time.sleep( 0.01 )
+    dev.record( filename, settings, generate )
+
+
+def check_frame( f, frame_number ):
+    test.check_equal( f.get_frame_number(), frame_number )
+    test.check_equal( f.get_profile().stream_type(), rs.stream.depth )
+    test.check( bytes( f.get_data() ) == bytes( pixels( frame_number )))
+
+
+#############################################################################################
+#
+for settings in [{ 'index': True }, {}]:
+    with test.closure( f"Frames by number, recorded with {settings}" ):
+        filename = os.path.join( temp_dir.name, f'rec{len( settings )}.bag' )
+        record( filename, settings )
+        player = rs.context().load_device( filename )
+        playback = player.as_playback()
+        play_profile = player.query_sensors()[0].get_stream_profiles()[0]
+        for n in [10, 1, N_FRAMES, 10]:
+            check_frame( playback.get_frame( play_profile, n ), n )
+        test.check_throws( lambda: playback.get_frame( play_profile, N_FRAMES + 1 ), RuntimeError )
+        test.check_equal( playback.current_status(), rs.playback_status.stopped )
+#
+#############################################################################################
+#
+with test.closure( "Frames nearest a time" ):
+    first = playback.get_frames_at( datetime.timedelta( 0 ))
+    test.check_equal( first.size(), 1 )
+    check_frame( first.get_depth_frame(), 1 )
+    last = playback.get_frames_at( playback.get_duration(), [play_profile] )
+    check_frame( last.get_depth_frame(), N_FRAMES )
+    test.check_throws( lambda: playback.get_frames_at( playback.get_duration() + datetime.timedelta( seconds = 1 )),
+                       RuntimeError )
+#
+#############################################################################################
+#
+with test.closure( "Frames held while reading more" ):
+    frames = [playback.get_frame( play_profile, n ) for n in range( 1, N_FRAMES + 1 )]
+    for n, f in enumerate( frames, 1 ):
+        check_frame( f, n )
+    del frames
+#
+#############################################################################################
+#
+with test.closure( "Playback not affected" ):
+    player.set_real_time( False )
+    play_sensor = player.query_sensors()[0]
+    numbers = []
+    play_sensor.open( play_profile )
+    play_sensor.start( lambda f: numbers.append( f.get_frame_number() ))
+    check_frame( playback.get_frame( play_profile, 20 ), 20 )
+    while playback.current_status() != rs.playback_status.stopped:
+        time.sleep( 0.1 )
+    play_sensor.stop()
+    play_sensor.close()
+    test.check_equal( numbers, list( range( 1, N_FRAMES + 1 )))
+#
+#############################################################################################
+#
+with test.closure( "Frames outlive the playback device" ):
+    # Uncompressed recordings hand out frames pointing into the mapped file; the mapping must stay with them
+    frames = [playback.get_frame( play_profile, n ) for n in [5, N_FRAMES]]
+    del playback, play_sensor, player
+    check_frame( frames[0], 5 )
+    check_frame( frames[1], N_FRAMES )
+    del frames
+#
+#############################################################################################
+
+test.print_results_and_exit()
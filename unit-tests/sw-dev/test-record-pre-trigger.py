@@ -0,0 +1,67 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# Recording with a pre-trigger: only the frames shortly before the trigger, and those after it, are written
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os, time
+import sw
+
+
+W = 640
+H = 480
+FPS = 30
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H, fps = FPS )
+
+pixels = bytearray( W * H * 2 )
+
+
+def record( filename, settings, n_before, n_after ):
+    """
+    Sends n_before frames in real time, triggers, then sends n_after more
+    """
+    def generate( recorder ):
+        for i in range( n_before + n_after ):
+            if i == n_before:
+                recorder.trigger()
+            dev.send( profile, pixels, i + 1 )
+            time.sleep( 1. / FPS )
+    dev.record( filename, settings, generate )
+
+
+#############################################################################################
+#
+with test.closure( "Invalid settings" ):
+    filename = os.path.join( temp_dir.name, 'invalid.bag' )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'pre-trigger': -1 } ), RuntimeError )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'pre-trigger': 1, 'pre-trigger-memory': 0 } ), RuntimeError )
+#
+#############################################################################################
+#
+with test.closure( "The last second before the trigger" ):
+    filename = os.path.join( temp_dir.name, 'pre-trigger.bag' )
+    record( filename, { 'pre-trigger': 1 }, 3 * FPS, FPS )
+    frame_numbers = sw.play( filename )
+    log.d( 'played', frame_numbers )
+    # Frames are sent no faster than FPS, so the last second holds at most FPS+1 of them
+    test.check( len( frame_numbers ) > FPS )
+    test.check( len( frame_numbers ) <= 2 * FPS + 1 )
+    test.check_equal( frame_numbers[-1], 4 * FPS )
+    test.check_equal( frame_numbers, list( range( frame_numbers[0], 4 * FPS + 1 )))
+#
+#############################################################################################
+#
+with test.closure( "Memory limit" ):
+    filename = os.path.join( temp_dir.name, 'pre-trigger-memory.bag' )
+    # Room for a single frame
+    record( filename, { 'pre-trigger': 10, 'pre-trigger-memory': 1 }, FPS, FPS )
+    test.check_equal( sw.play( filename ), list( range( FPS, 2 * FPS + 1 )))
+#
+#############################################################################################
+
+test.print_results_and_exit()
@@ -0,0 +1,129 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# Recording with a bounded queue of frames waiting to be written: frames written and dropped are accounted for
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os
+import sw
+
+
+W = 640
+H = 480
+N_FRAMES = 100
+FRAME_SIZE = W * H * 2
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H )
+
+pixels = bytearray( FRAME_SIZE )
+
+# A second stream, of large frames, for priorities
+COLOR_W = 1280
+COLOR_H = 720
+COLOR_FRAME_SIZE = COLOR_W * COLOR_H * 3
+color_profile = dev.add_video_stream( "Color", rs.stream.color, rs.format.rgb8, 3, COLOR_W, COLOR_H )
+color_pixels = bytearray( COLOR_FRAME_SIZE )
+
+
+def record( filename, settings ):
+    """
+    Sends N_FRAMES as fast as possible; returns the frames written, dropped, and the queue telemetry
+    """
+    def generate( recorder ):
+        for i in range( N_FRAMES ):
+            dev.send( profile, pixels, i + 1 )
+        recorder.pause()  # waits for the queue to be written
+        return ( recorder.frames_written( rs.stream.depth ), recorder.frames_dropped( rs.stream.depth ), recorder.queue_telemetry() )
+    result = dev.record( filename, settings, generate, sensors = ["Depth"] )
+    log.d( settings, 'written', result[0], 'dropped', result[1], 'max bytes', result[2].max_bytes, 'max latency', result[2].max_latency )
+    return result
+
+
+def frames_in( filename ):
+    return len( sw.play( filename ))
+
+
+#############################################################################################
+#
+with test.closure( "Invalid settings" ):
+    filename = os.path.join( temp_dir.name, 'invalid.bag' )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'queue-policy': 'drop-oldest' } ), RuntimeError )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'queue-memory': 0 } ), RuntimeError )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'stream-priority': { 'Sonar': 1 } } ), RuntimeError )
+#
+#############################################################################################
+#
+with test.closure( "Unbounded" ):
+    filename = os.path.join( temp_dir.name, 'unbounded.bag' )
+    written, dropped, telemetry = record( filename, {} )
+    test.check_equal( written, N_FRAMES )
+    test.check_equal( dropped, 0 )
+    test.check_equal( telemetry.frames, 0 )
+    test.check_equal( telemetry.bytes, 0 )
+    test.check( telemetry.max_bytes >= FRAME_SIZE )
+    test.check( telemetry.max_latency >= telemetry.latency )
+    test.check_equal( frames_in( filename ), N_FRAMES )
+#
+#############################################################################################
+#
+with test.closure( "Block" ):
+    filename = os.path.join( temp_dir.name, 'block.bag' )
+    # Room for a single frame
+    written, dropped, telemetry = record( filename, { 'queue-policy': 'block', 'queue-memory': 1 } )
+    test.check_equal( written, N_FRAMES )
+    test.check_equal( dropped, 0 )
+    test.check( telemetry.max_bytes <= FRAME_SIZE )
+    test.check_equal( frames_in( filename ), N_FRAMES )
+#
+#############################################################################################
+#
+with test.closure( "Drop newest" ):
+    filename = os.path.join( temp_dir.name, 'drop-newest.bag' )
+    written, dropped, telemetry = record( filename, { 'queue-policy': 'drop-newest', 'queue-memory': 1 } )
+    test.check_equal( written + dropped, N_FRAMES )
+    test.check( written > 0 )
+    test.check( telemetry.max_bytes <= FRAME_SIZE )
+    test.check_equal( frames_in( filename ), written )
+#
+#############################################################################################
+#
+with test.closure( "Drop by priority" ):
+    filename = os.path.join( temp_dir.name, 'drop-by-priority.bag' )
+    # Room for all the depth frames and one color frame: depth frames can always make room by dropping color frames,
+    # and are never dropped themselves, while color frames are dropped once they fall behind
+    memory = N_FRAMES * FRAME_SIZE + COLOR_FRAME_SIZE
+    def generate( recorder ):
+        for i in range( N_FRAMES ):
+            dev.send( color_profile, color_pixels, i + 1 )
+            dev.send( profile, pixels, i + 1 )
+        recorder.pause()  # waits for the queue to be written
+        return ( recorder.frames_written( rs.stream.depth ), recorder.frames_dropped( rs.stream.depth ),
+                 recorder.frames_written( rs.stream.color ), recorder.frames_dropped( rs.stream.color ),
+                 recorder.queue_telemetry() )
+    depth_written, depth_dropped, color_written, color_dropped, telemetry = dev.record(
+        filename, { 'queue-policy': 'drop-by-priority',
+                    'queue-memory': memory / ( 1 << 20 ),
+                    'stream-priority': { 'Depth': 1 } }, generate )
+    log.d( 'depth written', depth_written, 'dropped', depth_dropped, '; color written', color_written, 'dropped', color_dropped )
+    # Only the color stream, of lower priority, is dropped from
+    test.check_equal( depth_dropped, 0 )
+    test.check_equal( depth_written, N_FRAMES )
+    test.check_equal( color_written + color_dropped, N_FRAMES )
+    test.check( telemetry.max_bytes <= memory )
+#
+#############################################################################################
+#
+with test.closure( "Counts of other streams" ):
+    filename = os.path.join( temp_dir.name, 'other.bag' )
+    recorder = rs.recorder( filename, dev.handle )
+    test.check_equal( recorder.frames_written( rs.stream.color ), 0 )
+    test.check_equal( recorder.frames_dropped( rs.stream.depth, 1 ), 0 )
+    del recorder
+#
+#############################################################################################
+
+test.print_results_and_exit()
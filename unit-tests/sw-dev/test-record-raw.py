@@ -0,0 +1,118 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# Recording in the raw format (video frames written as is to <file>.frames), and playing it back
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os, shutil, struct
+import sw
+
+
+W = 640
+H = 480
+N_FRAMES = 30
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+filename = os.path.join( temp_dir.name, 'rec.bag' )
+
+dev = sw.recording_device()
+profile = dev.add_video_stream( width = W, height = H )
+
+
+def pixels( frame_number ):
+    return bytearray( [frame_number % 256] ) * ( W * H * 2 )
+
+
+def record( settings ):
+    def generate( recorder ):
+        for i in range( N_FRAMES ):
+            dev.send( profile, pixels( i + 1 ), i + 1 )
+    dev.record( filename, settings, generate )
+
+
+def play():
+    player = sw.load( filename )
+    frames = []
+    def on_frame( f ):
+        frames.append(( f.get_frame_number(), f.get_timestamp(), f.get_frame_timestamp_domain(),
+                        bytes( f.get_data() ) == bytes( pixels( f.get_frame_number() ))))
+    sw.play( player, on_frame )
+    return frames, player
+
+
+expected_frames = [( i + 1, i * 1000. / 30, rs.timestamp_domain.hardware_clock, True ) for i in range( N_FRAMES )]
+
+
+#############################################################################################
+#
+with test.closure( "Raw format doesn't take a depth codec" ):
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'format': 'raw', 'depth-codec': 'rvl' } ), RuntimeError )
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'format': 'mp4' } ), RuntimeError )
+#
+#############################################################################################
+#
+with test.closure( "Record" ):
+    record( { 'format': 'raw' } )
+    test.check( os.path.exists( filename + '.frames' ))
+    # The frames aren't in the bag
+    test.check( os.path.getsize( filename ) < N_FRAMES * W * H * 2 / 10 )
+#
+#############################################################################################
+#
+with test.closure( "Play back" ):
+    frames, player = play()
+    test.check_equal( frames, expected_frames )
+    playback = player.as_playback()
+    play_sensor = player.query_sensors()[0]
+#
+#############################################################################################
+#
+with test.closure( "Frames by number" ):
+    play_profile = play_sensor.get_stream_profiles()[0]
+    f = playback.get_frame( play_profile, 10 )
+    test.check_equal( f.get_frame_number(), 10 )
+    test.check( bytes( f.get_data() ) == bytes( pixels( 10 )))
+    del f, play_sensor, playback, player
+#
+#############################################################################################
+#
+with test.closure( "A stale frames file next to a bag is not played" ):
+    # A bag recorded over a raw recording leaves the frames file alone
+    stale = os.path.join( temp_dir.name, 'stale.frames' )
+    shutil.copy( filename + '.frames', stale )
+    record( {} )
+    test.check( os.path.exists( filename + '.frames' ))
+    with open( filename + '.frames', 'rb' ) as f, open( stale, 'rb' ) as g:
+        test.check( f.read() == g.read() )
+    frames, player = play()
+    test.check_equal( frames, expected_frames )
+    del player
+#
+#############################################################################################
+#
+with test.closure( "A raw recording that didn't end properly still plays what's in the bag" ):
+    record( { 'format': 'raw' } )
+    # The header, with the index offset, is written last
+    with open( filename + '.frames', 'r+b' ) as f:
+        f.write( bytes( 4096 ))
+    frames, player = play()
+    test.check_equal( frames, [] )
+    del player
+#
+#############################################################################################
+#
+with test.closure( "A frames file with a corrupt stream count is not read" ):
+    record( { 'format': 'raw' } )
+    with open( filename + '.frames', 'r+b' ) as f:
+        f.seek( 16 )  # past the magic, version and byte order
+        index_offset, = struct.unpack( '=Q', f.read( 8 ))
+        f.seek( index_offset )
+        f.write( struct.pack( '=I', 0xffffffff ))
+    frames, player = play()
+    test.check_equal( frames, [] )
+    del player
+#
+#############################################################################################
+
+test.print_results_and_exit()
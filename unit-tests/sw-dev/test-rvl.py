@@ -0,0 +1,97 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# RVL depth encoding: the encoder/decoder blocks, and recording depth RVL-encoded
+
+import pyrealsense2 as rs
+from rspy import log, test
+import tempfile, os
+import sw
+
+
+W = 640
+H = 480
+N_FRAMES = 10
+
+temp_dir = tempfile.TemporaryDirectory( prefix = 'recordings_' )
+filename = os.path.join( temp_dir.name, 'rec.bag' )
+
+dev = sw.recording_device()
+dev.sensor( "Depth" ).add_read_only_option( rs.option.depth_units, 0.001 )
+profile = dev.add_video_stream( width = W, height = H )
+
+
+def depth_pixels( i ):
+    """
+    A slanted plane with a column of holes, which RVL encodes well
+    """
+    pixels = bytearray()
+    for y in range( H ):
+        row = [0 if x % 50 < 3 else 1000 + i + y + x // 4 for x in range( W )]
+        pixels += b''.join( d.to_bytes( 2, 'little' ) for d in row )
+    return pixels
+
+images = [depth_pixels( i ) for i in range( 2 )]
+
+
+def generate_frames( n ):
+    for i in range( n ):
+        dev.send( profile, images[i % 2], i + 1 )
+
+
+#############################################################################################
+#
+with test.closure( "Encoder and decoder blocks" ):
+    q = rs.frame_queue( 1 )
+    sensor = dev.sensor( "Depth" )
+    sensor.open( profile )
+    sensor.start( q )
+    generate_frames( 1 )
+    f = q.wait_for_frame()
+    sensor.stop()
+    sensor.close()
+
+    encoded = rs.rvl_encoder().process( f )
+    test.check_equal( encoded.get_profile().format(), rs.format.z16rvl )
+    test.check_equal( encoded.as_video_frame().get_width(), W )
+    encoded_size = len( bytes( encoded.get_data() ))
+    log.d( f'{W * H * 2} bytes encoded to {encoded_size}' )
+    test.check( encoded_size < W * H * 2 / 4 )
+
+    decoded = rs.rvl_decoder().process( encoded )
+    test.check_equal( decoded.get_profile().format(), rs.format.z16 )
+    test.check( decoded.is_depth_frame() )
+    test.check_equal( bytes( decoded.get_data() ), bytes( images[0] ))
+#
+#############################################################################################
+#
+with test.closure( "Record depth RVL-encoded" ):
+    dev.record( filename, { 'depth-codec': 'rvl', 'compression': False }, lambda recorder: generate_frames( N_FRAMES ))
+    log.d( f'file is {os.path.getsize( filename )} bytes' )
+    test.check( os.path.getsize( filename ) < N_FRAMES * W * H * 2 / 4 )
+#
+#############################################################################################
+#
+with test.closure( "RVL-encoded depth plays back as Z16" ):
+    player = sw.load( filename )
+    test.check_equal( player.query_sensors()[0].get_stream_profiles()[0].format(), rs.format.z16 )
+
+    frames = []
+    def on_frame( f ):
+        frames.append(( f.get_frame_number(), f.get_profile().format(), bytes( f.get_data() )))
+    sw.play( player, on_frame )
+
+    test.check_equal( len( frames ), N_FRAMES )
+    for number, fmt, data in frames:
+        test.check_equal( fmt, rs.format.z16 )
+        test.check( data == bytes( images[( number - 1 ) % 2] ))
+#
+#############################################################################################
+#
+with test.closure( "Invalid depth codec" ):
+    test.check_throws( lambda: rs.recorder( filename, dev.handle, { 'depth-codec': 'png' } ),
+                       RuntimeError, "invalid depth-codec 'png'; expecting 'none' or 'rvl'" )
+#
+#############################################################################################
+
+test.print_results_and_exit()
@@ -0,0 +1,54 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+
+
+sw.fps_c = sw.fps_d = 60
+sw.init()
+sw.start()
+
+
+def get_trace():
+    f = sw.syncer.poll_for_frame()
+    test.check( f )
+    trace = f.get_trace()
+    log.d( f, trace )
+    return trace
+
+
+#############################################################################################
+#
+with test.closure( "Nothing is traced by default" ):
+    sw.generate_depth_and_color( frame_number = 0, timestamp = 0 )
+    test.check_equal( len( get_trace() ), 0 )
+    sw.syncer.poll_for_frame()  # the color frame
+#
+#############################################################################################
+#
+with test.closure( "Every hop is traced, in order" ):
+    rs.enable_frame_trace( True )
+    sw.generate_depth_and_color( 1, sw.gap_d )
+    trace = get_trace()
+    stages = [stage for stage, time in trace]
+    test.check_equal( stages, [rs.frame_trace_stage.arrival,
+                               rs.frame_trace_stage.sync_start,
+                               rs.frame_trace_stage.sync_end,
+                               rs.frame_trace_stage.delivery] )
+    times = [time for stage, time in trace]
+    test.check_equal( times, sorted( times ))
+#
+#############################################################################################
+#
+with test.closure( "Tracing can be disabled again" ):
+    rs.enable_frame_trace( False )
+    sw.generate_depth_and_color( 2, sw.gap_d * 2 )
+    test.check_equal( len( get_trace() ), 0 )
+#
+#############################################################################################
+
+sw.stop()
+sw.reset()
+test.print_results_and_exit()
@@ -0,0 +1,123 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import time
+
+
+FPS = 30
+GAP = 1000. / FPS
+OFFSET = 3.  # ms by which the second device's timestamps trail the first's
+W = 64
+H = 48
+BPP = 2
+
+pixels = bytearray( b'\x00' * ( W * H * BPP ))
+
+
+class camera:
+    def __init__( self, name, uid ):
+        self.device = rs.software_device()
+        self.device.create_matcher( rs.matchers.default )
+        self.sensor = self.device.add_sensor( name )
+        vs = rs.video_stream()
+        vs.type = rs.stream.depth
+        vs.uid = uid
+        vs.width = W
+        vs.height = H
+        vs.fps = FPS
+        vs.bpp = BPP
+        vs.fmt = rs.format.z16
+        self.profile = rs.video_stream_profile( self.sensor.add_video_stream( vs ))
+
+    def start( self, syncer ):
+        self.sensor.open( self.profile )
+        self.sensor.start( syncer )
+
+    def stop( self ):
+        self.sensor.stop()
+        self.sensor.close()
+
+    def generate( self, frame_number, timestamp ):
+        frame = rs.software_video_frame()
+        frame.pixels = pixels
+        frame.stride = W * BPP
+        frame.bpp = BPP
+        frame.frame_number = frame_number
+        frame.timestamp = timestamp
+        frame.domain = rs.timestamp_domain.global_time
+        frame.profile = self.profile
+        log.d( "-->", frame )
+        self.sensor.on_video_frame( frame )
+
+
+def expect( syncer, *frame_numbers ):
+    fs = syncer.wait_for_frames( 1000 )
+    log.d( "<--", fs )
+    test.check_equal( fs.size(), len( frame_numbers ))
+    test.check_equal( sorted( f.get_frame_number() for f in fs ), sorted( frame_numbers ))
+
+
+def expect_nothing( syncer ):
+    fs = syncer.poll_for_frames()
+    test.check( not fs )
+
+
+def start( syncer ):
+    a = camera( "A", 0 )
+    b = camera( "B", 1 )
+    a.start( syncer )
+    b.start( syncer )
+    # The syncer does not know about a device until it gets a frame from it
+    a.generate( 0, 0 )
+    expect( syncer, 0 )
+    b.generate( 0, OFFSET )
+    expect( syncer, 0 )
+    return a, b
+
+
+#############################################################################################
+#
+with test.closure( "Frames of different devices within tolerance are grouped" ):
+    syncer = rs.multi_device_syncer( tolerance_ms = 5, max_wait_ms = 50, queue_size = 100 )
+    a, b = start( syncer )
+    for i in range( 1, 6 ):
+        a.generate( i, i * GAP )
+        expect_nothing( syncer )  # waiting for B
+        b.generate( i, i * GAP + OFFSET )
+        expect( syncer, i, i )
+#
+#############################################################################################
+#
+with test.closure( "A frameset is not held longer than the maximum wait" ):
+    a.generate( 6, 6 * GAP )
+    expect_nothing( syncer )
+    time.sleep( 0.2 )
+    a.generate( 7, 7 * GAP )
+    expect( syncer, 6 )  # B is still missing, but we waited long enough
+    expect_nothing( syncer )
+    a.stop()
+    b.stop()
+#
+#############################################################################################
+#
+with test.closure( "Frames of different devices beyond tolerance are not grouped" ):
+    syncer = rs.multi_device_syncer( tolerance_ms = 1, queue_size = 100 )
+    a, b = start( syncer )
+    for i in range( 1, 4 ):
+        a.generate( i, i * GAP )
+        expect( syncer, i )
+        b.generate( i, i * GAP + OFFSET )
+        expect( syncer, i )
+    a.stop()
+    b.stop()
+#
+#############################################################################################
+#
+with test.closure( "Invalid tolerance" ):
+    test.check_throws( lambda: rs.multi_device_syncer( tolerance_ms = -1 ), RuntimeError )
+#
+#############################################################################################
+
+test.print_results_and_exit()
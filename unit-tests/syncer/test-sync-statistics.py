@@ -0,0 +1,86 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+
+
+sw.fps_c = sw.fps_d = 60
+sw.init()
+sw.start()
+
+
+def get_statistics():
+    stats = json.loads( sw.syncer.get_statistics() )
+    log.d( stats )
+    return stats
+
+
+def get_stream( stats, stream_type ):
+    return next( s for s in stats['streams'] if s['stream'] == stream_type )
+
+
+#############################################################################################
+#
+with test.closure( "Not collected unless enabled" ):
+    sw.generate_depth_and_color( frame_number = 0, timestamp = 0 )
+    sw.expect( depth_frame = 0 )
+    sw.expect( color_frame = 0, nothing_else = True )
+    stats = get_statistics()
+    test.check_false( stats['enabled'] )
+    test.check_equal( len( stats['streams'] ), 0 )
+    test.check_equal( sum( stats['releases'].values() ), 0 )
+    sw.syncer.enable_statistics()
+#
+#############################################################################################
+#
+with test.closure( "Nothing synced yet" ):
+    stats = get_statistics()
+    test.check( stats['enabled'] )
+    test.check_equal( len( stats['streams'] ), 0 )
+    test.check_equal( sum( stats['releases'].values() ), 0 )
+#
+#############################################################################################
+#
+with test.closure( "Hold times and releases are counted" ):
+    sw.generate_depth_and_color( frame_number = 1, timestamp = sw.gap_d )
+    sw.expect( depth_frame = 1, color_frame = 1, nothing_else = True )
+    for i in range( 2, 6 ):
+        sw.generate_depth_and_color( i, sw.gap_d * i )
+        sw.expect( depth_frame = i, color_frame = i, nothing_else = True )
+
+    stats = get_statistics()
+    test.check_equal( len( stats['streams'] ), 2 )
+    for stream_type in ['Depth', 'Color']:
+        stream = get_stream( stats, stream_type )
+        test.check_equal( stream['released'], 5 )
+        test.check_equal( stream['dropped'], 0 )
+        test.check_equal( stream['pending'], 0 )
+        test.check_equal( sum( stream['histogram'] ), 5 )
+        test.check( stream['max-hold-us'] >= stream['mean-hold-us'] )
+    test.check_equal( len( stats['histogram-bounds-us'] ) + 1, len( get_stream( stats, 'Depth' )['histogram'] ))
+    test.check( stats['releases']['complete'] >= 4 )
+#
+#############################################################################################
+#
+with test.closure( "A frame waiting for its partner is pending" ):
+    sw.generate_depth_frame( 6, sw.gap_d * 6 )
+    stats = get_statistics()
+    test.check_equal( get_stream( stats, 'Depth' )['pending'], 1 )
+    test.check_equal( get_stream( stats, 'Depth' )['released'], 5 )
+#
+#############################################################################################
+#
+with test.closure( "Statistics can be reset" ):
+    sw.syncer.reset_statistics()
+    stats = get_statistics()
+    test.check_equal( len( stats['streams'] ), 0 )
+    test.check_equal( sum( stats['releases'].values() ), 0 )
+#
+#############################################################################################
+
+sw.stop()
+sw.reset()
+test.print_results_and_exit()
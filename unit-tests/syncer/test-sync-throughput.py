@@ -0,0 +1,121 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#test:donotrun:!nightly
+
+# Benchmark of the syncer with many streams: several synthetic devices, each with several streams, all feed a single
+# syncer. We measure the latency from the first frame of a set being dispatched to the frameset being available, and
+# the overall throughput.
+#
+# To compare matcher implementations, run it on the old revision with RS_SYNC_BENCHMARK_OUTPUT=<file> to save the
+# results, then on the new one with RS_SYNC_BENCHMARK_BASELINE=<file>: the new latency and throughput are checked against
+# the old ones.
+
+import pyrealsense2 as rs
+from rspy import log, test
+from rspy.stopwatch import Stopwatch
+import json, os
+
+N_DEVICES = 2
+STREAMS = [rs.stream.depth, rs.stream.color, rs.stream.infrared, rs.stream.infrared, rs.stream.confidence, rs.stream.fisheye]
+N_FRAMESETS = 2000
+FPS = 60
+W = 64
+H = 48
+BPP = 2
+
+pixels = bytearray( b'\x00' * ( W * H * BPP ))
+syncer = rs.syncer( 100 )
+
+devices = []
+sources = []  # ( sensor, profile )
+uid = 0
+for d in range( N_DEVICES ):
+    device = rs.software_device()
+    device.create_matcher( rs.matchers.default )
+    for i, stream_type in enumerate( STREAMS ):
+        sensor = device.add_sensor( "Sensor " + str( i ) )
+        vs = rs.video_stream()
+        vs.type = stream_type
+        vs.index = i
+        vs.uid = uid
+        uid += 1
+        vs.width = W
+        vs.height = H
+        vs.fps = FPS
+        vs.bpp = BPP
+        vs.fmt = rs.format.z16
+        profile = rs.video_stream_profile( sensor.add_video_stream( vs ))
+        sensor.open( profile )
+        sensor.start( syncer )
+        sources.append(( sensor, profile ))
+    devices.append( device )
+
+
+def generate( sensor, profile, n ):
+    frame = rs.software_video_frame()
+    frame.pixels = pixels
+    frame.stride = W * BPP
+    frame.bpp = BPP
+    frame.frame_number = n
+    frame.timestamp = n * 1000. / FPS
+    frame.domain = rs.timestamp_domain.hardware_clock
+    frame.profile = profile
+    sensor.on_video_frame( frame )
+
+
+#############################################################################################
+#
+with test.closure( "Sync latency and throughput with " + str( len( sources )) + " streams" ):
+    latencies = []
+    received_frames = 0
+    total = Stopwatch()
+    for n in range( N_FRAMESETS ):
+        # Frames are dispatched to the syncer, and synced, synchronously: time it all
+        sw = Stopwatch()
+        for sensor, profile in sources:
+            generate( sensor, profile, n )
+        while True:
+            fs = syncer.poll_for_frames()
+            if not fs:
+                break
+            latencies.append( sw.get_elapsed() )
+            received_frames += fs.size()
+    elapsed = total.get_elapsed()
+
+    latencies.sort()
+    # Frames of the last iterations may still be waiting for their counterparts
+    test.check( received_frames >= ( N_FRAMESETS - 2 ) * len( sources ))
+    if latencies:
+        results = {
+            'median': latencies[len( latencies ) // 2],
+            'p99': latencies[len( latencies ) * 99 // 100],
+            'max': latencies[-1],
+            'throughput': received_frames / elapsed
+            }
+        log.i( "framesets:", len( latencies ), " frames:", received_frames )
+        log.i( "latency [us]: median", round( results['median'] * 1e6, 1 ),
+               " p99", round( results['p99'] * 1e6, 1 ),
+               " max", round( results['max'] * 1e6, 1 ))
+        log.i( "throughput:", round( results['throughput'] ), "frames/sec" )
+
+        output = os.environ.get( 'RS_SYNC_BENCHMARK_OUTPUT' )
+        if output:
+            with open( output, 'w' ) as f:
+                json.dump( results, f )
+        baseline = os.environ.get( 'RS_SYNC_BENCHMARK_BASELINE' )
+        if baseline:
+            with open( baseline ) as f:
+                old = json.load( f )
+            log.i( "baseline: latency median", round( old['median'] * 1e6, 1 ), "us; throughput",
+                   round( old['throughput'] ), "frames/sec" )
+            # Allow for some noise between runs
+            test.check( results['median'] <= old['median'] * 1.1 )
+            test.check( results['throughput'] >= old['throughput'] * 0.9 )
+#
+#############################################################################################
+
+for sensor, profile in sources:
+    sensor.stop()
+    sensor.close()
+test.print_results_and_exit()
@@ -0,0 +1,69 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+
+
+sw.init()
+sw.depth_sensor.set_option( rs.option.frames_queue_size, 2 )
+sw.start()
+sw.syncer.enable_statistics()  # for the frames held per stream
+
+
+def get_depth_archive():
+    telemetry = json.loads( sw.depth_sensor.get_telemetry() )
+    log.d( telemetry )
+    archives = [a for a in telemetry['archives'] if a.get( 'stream' ) == 'Depth']
+    test.check_equal( len( archives ), 1 )
+    return archives[0]
+
+
+#############################################################################################
+#
+with test.closure( "Published frames are counted" ):
+    for i in range( 2 ):
+        sw.generate_depth_frame( i, i * sw.gap_d )
+    archive = get_depth_archive()
+    test.check_equal( archive['max-published'], 2 )
+    test.check_equal( archive['published-total'], 2 )
+    test.check_equal( archive['published'], 2 )
+    test.check_equal( archive['publish-failures'], 0 )
+#
+#############################################################################################
+#
+with test.closure( "Frames still held make publishing fail" ):
+    for i in range( 2, 5 ):
+        sw.generate_depth_frame( i, i * sw.gap_d )
+    archive = get_depth_archive()
+    test.check_equal( archive['published-total'], 2 )
+    test.check_equal( archive['published'], 2 )
+    test.check_equal( archive['publish-failures'], 3 )
+#
+#############################################################################################
+#
+with test.closure( "Syncer queue occupancy" ):
+    telemetry = json.loads( sw.syncer.get_telemetry() )
+    log.d( telemetry )
+    queue = telemetry['queues'][0]
+    test.check_equal( queue['capacity'], 100 )
+    test.check( queue['size'] >= 1 )
+    test.check( 'pending' in telemetry )
+#
+#############################################################################################
+#
+with test.closure( "Released frames go to the freelist" ):
+    while sw.syncer.poll_for_frame():
+        pass
+    archive = get_depth_archive()
+    test.check_equal( archive['published'], 0 )
+    test.check_equal( archive['freelist-size'], 2 )
+    test.check_equal( json.loads( sw.syncer.get_telemetry() )['queues'][0]['size'], 0 )
+#
+#############################################################################################
+
+sw.stop()
+sw.reset()
+test.print_results_and_exit()
@@ -96,7 +96,13 @@ public enum Option {
     OPTION_AUTO_EXPOSURE_LIMIT_TOGGLE(91),
     OPTION_AUTO_GAIN_LIMIT_TOGGLE(92),
     OPTION_EMITTER_FREQUENCY(93),
-    OPTION_DEPTH_AUTO_EXPOSURE_MODE(94);
+    OPTION_DEPTH_AUTO_EXPOSURE_MODE(94),
+    FILTER_ROI_MIN_X(98),
+    FILTER_ROI_MIN_Y(99),
+    FILTER_ROI_MAX_X(100),
+    FILTER_ROI_MAX_Y(101),
+    FILTER_ROI_HALO(102),
+    RESULT_CACHE_SIZE(103);
 
 
     private final int mValue;
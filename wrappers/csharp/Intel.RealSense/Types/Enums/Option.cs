@@ -285,6 +285,24 @@ namespace Intel.RealSense
         vertical_binning = 89,
 
         /// <summary>Control the receiver sensitivity to incoming light, both projected and ambient</summary>
-        receiver_sensitivity = 90
+        receiver_sensitivity = 90,
+
+        /// <summary>Left edge (inclusive, in input pixels) of the region of interest a post-processing block computes. An empty region processes the whole frame</summary>
+        filter_roi_min_x = 98,
+
+        /// <summary>Top edge (inclusive, in input pixels) of the region of interest a post-processing block computes</summary>
+        filter_roi_min_y = 99,
+
+        /// <summary>Right edge (exclusive, in input pixels) of the region of interest a post-processing block computes</summary>
+        filter_roi_max_x = 100,
+
+        /// <summary>Bottom edge (exclusive, in input pixels) of the region of interest a post-processing block computes</summary>
+        filter_roi_max_y = 101,
+
+        /// <summary>Number of context pixels around the region of interest fed to neighbourhood filters</summary>
+        filter_roi_halo = 102,
+
+        /// <summary>Number of recent results a processing block keeps to serve repeated processing of the same input frame</summary>
+        result_cache_size = 103
     }
 }
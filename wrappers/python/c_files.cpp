@@ -31,6 +31,7 @@ void init_c_files(py::module &m) {
     BIND_ENUM(m, rs2_timestamp_domain, RS2_TIMESTAMP_DOMAIN_COUNT, "Specifies the clock in relation to which the frame timestamp was measured.")
     BIND_ENUM(m, rs2_frame_metadata_value, RS2_FRAME_METADATA_COUNT, "Per-Frame-Metadata is the set of read-only properties that might be exposed for each individual frame.")
     BIND_ENUM(m, rs2_calib_target_type, RS2_CALIB_TARGET_COUNT, "Calibration target type.")
+    BIND_ENUM(m, rs2_frame_trace_stage, RS2_FRAME_TRACE_STAGE_COUNT, "Hops of a frame on its way to the application, as recorded by frame tracing.")
 
     BIND_ENUM(m, rs2_option, RS2_OPTION_COUNT+1, "Defines general configuration controls. These can generally be mapped to camera UVC controls, and can be set / queried at any time unless stated otherwise.")
     // Without __repr__ and __str__, we get the default 'enum_base' showing '???'
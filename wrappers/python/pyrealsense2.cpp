@@ -44,6 +44,12 @@ PYBIND11_MODULE(NAME, m) {
     m.def("log_to_file", &rs2::log_to_file, "min_severity"_a, "file_path"_a);
     m.def("reset_logger", &rs2::reset_logger);
     m.def("enable_rolling_log_file", &rs2::enable_rolling_log_file, "max_size"_a);
+    m.def("start_trace", &rs2::start_trace, "Start writing a trace of the library's internal threads and hot paths to a "
+          "file, in Chrome trace-event JSON format", "file_path"_a);
+    m.def("stop_trace", &rs2::stop_trace, "End the trace started with start_trace(), writing out all pending events");
+    m.def("enable_async_logging", &rs2::enable_async_logging, "Queue the messages logged on the streaming path for a "
+          "background thread to write, rather than writing them on the streaming threads", "enable"_a,
+          py::call_guard< py::gil_scoped_release >() );  // disabling writes out pending messages, maybe to callbacks
 
     // Access to log_message is only from a callback (see log_to_callback below) and so already
     // should have the GIL acquired
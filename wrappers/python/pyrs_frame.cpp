@@ -127,6 +127,9 @@ void init_frame(py::module &m) {
     py::class_<rs2::filter_interface> filter_interface(m, "filter_interface", "Interface for frame filtering functionality");
     filter_interface.def("process", &rs2::filter_interface::process, "frame"_a); // No docstring in C++
 
+    m.def("enable_frame_trace", &rs2::enable_frame_trace, "Enable or disable frame tracing for the whole process: while enabled, "
+          "every frame records when it passed each hop through the library (see frame.get_trace).", "enable"_a);
+
     py::class_<rs2::frame> frame(m, "frame", "Base class for multiple frame extensions");
     frame.def(py::init<>())
         // .def(py::self = py::self) // can't overload assignment in python
@@ -137,9 +140,20 @@ void init_frame(py::module &m) {
         .def("get_timestamp", &rs2::frame::get_timestamp, "Retrieve the time at which the frame was captured")
         .def_property_readonly("timestamp", &rs2::frame::get_timestamp, "Time at which the frame was captured. Identical to calling get_timestamp.")
         .def("get_frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "Retrieve the timestamp domain.")
+        .def("get_trace", &rs2::frame::get_trace, "Retrieve the (stage, time) hops the frame went through while frame tracing "
+             "was enabled. Times are in milliseconds of a monotonic clock; only differences between them are meaningful.")
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
         .def("get_frame_metadata", &rs2::frame::get_frame_metadata, "Retrieve the current value of a single frame_metadata.", "frame_metadata"_a)
         .def("supports_frame_metadata", &rs2::frame::supports_frame_metadata, "Determine if the device allows a specific metadata to be queried.", "frame_metadata"_a)
+        .def("get_frame_metadata_values", [](const rs2::frame& self) {
+            rs2::frame_metadata_values md;
+            self.get_frame_metadata_values(md);
+            std::map<rs2_frame_metadata_value, rs2_metadata_type> values;
+            for (int i = 0; i < RS2_FRAME_METADATA_COUNT; ++i)
+                if (md.is_valid[i])
+                    values.emplace(static_cast<rs2_frame_metadata_value>(i), md.values[i]);
+            return values;
+        }, "Retrieve all the metadata the frame supports in a single call, as a {frame_metadata_value: value} dict.")
         .def("get_frame_number", &rs2::frame::get_frame_number, "Retrieve the frame number.")
         .def_property_readonly("frame_number", &rs2::frame::get_frame_number, "The frame number. Identical to calling get_frame_number.")
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
@@ -68,6 +68,9 @@ void init_pipeline(py::module &m) {
              "This request cannot be used if enable_record_to_file() is called for the current config, and vice versa.", "file_name"_a, "repeat_playback"_a = true)
         .def("enable_record_to_file", &rs2::config::enable_record_to_file, "Requires that the resolved device would be recorded to file.\n"
              "This request cannot be used if enable_device_from_file() is called for the current config, and vice versa as available.", "file_name"_a)
+        .def("set_conflating", &rs2::config::set_conflating, "Requires that the pipeline delivers only the latest frameset: frames superseded "
+             "before the application gets to them are released immediately, and a callback that is still busy with a frameset gets the freshest "
+             "one next, rather than every frameset in turn.", "conflating"_a)
         .def("disable_stream", &rs2::config::disable_stream, "Disable a device stream explicitly, to remove any requests on this stream profile.\n"
              "The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the stream configuration.", "stream"_a, "index"_a = -1)
         .def("disable_all_streams", &rs2::config::disable_all_streams, "Disable all device stream explicitly, to remove any requests on the streams profiles.\n"
@@ -169,6 +172,8 @@ void init_pipeline(py::module &m) {
             auto success = self.try_wait_for_frames(&fs, timeout_ms);
             return std::make_tuple(success, fs);
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>())
-        .def("get_active_profile", &rs2::pipeline::get_active_profile); // No docstring in C++
+        .def("get_active_profile", &rs2::pipeline::get_active_profile) // No docstring in C++
+        .def("get_start_report", &rs2::pipeline::get_start_report, "Return the start-up timing of the last successful start(), "
+             "as JSON text: the time spent resolving the configuration, opening every sensor, and starting streaming, in milliseconds.");
     /** end rs_pipeline.hpp **/
 }
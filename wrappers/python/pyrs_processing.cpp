@@ -44,6 +44,8 @@ void init_processing(py::module &m) {
         .def("__call__", &rs2::frame_queue::operator(), "Identical to calling enqueue.", "f"_a)
         .def("capacity", &rs2::frame_queue::capacity, "Return the capacity of the queue.")
         .def("size", &rs2::frame_queue::size, "Number of enqueued frames.")
+        .def("set_conflating", &rs2::frame_queue::set_conflating, "Keep only the latest frame, releasing any frame it "
+             "supersedes immediately, so that the consumer always gets the freshest one.", "conflating"_a)
         .def("keep_frames", &rs2::frame_queue::keep_frames, "Return whether or not the queue calls keep on enqueued frames.");
 
     py::class_<rs2::processing_block, rs2::options> processing_block(m, "processing_block", "Define the processing block workflow, inherit this class to "
@@ -55,8 +57,13 @@ void init_processing(py::module &m) {
             self.start(f);
         }, "Start the processing block with callback function to inform the application the frame is processed.", "callback"_a)
         .def("invoke", &rs2::processing_block::invoke, "Ask processing block to process the frame", "f"_a)
+        .def_static("process_batch", &rs2::processing_block::process_batch, "Process a batch of frames through a chain of processing blocks, "
+            "running consecutive blocks concurrently while each block sees the frames in order. Returns, for each input frame, the last frame "
+            "produced from it.", "chain"_a, "frames"_a, py::call_guard<py::gil_scoped_release>())
         .def("supports", (bool (rs2::processing_block::*)(rs2_camera_info) const) &rs2::processing_block::supports, "Check if a specific camera info field is supported.")
-        .def("get_info", &rs2::processing_block::get_info, "Retrieve camera specific information, like versions of various internal components.");
+        .def("get_info", &rs2::processing_block::get_info, "Retrieve camera specific information, like versions of various internal components.")
+        .def("get_telemetry", &rs2::processing_block::get_telemetry, "Frame memory and queue telemetry of the block, as JSON text: "
+             "the counters of its frame archives and, for a syncer, the occupancy of its queues");
         /*.def("__call__", &rs2::processing_block::operator(), "f"_a)*/
         // supports(camera_info) / get_info(camera_info)?
 
@@ -129,7 +136,30 @@ void init_processing(py::module &m) {
         .def( "try_wait_for_frame",  // same, but with a name that matches frame_queue!
               wait_for_frame,
               "timeout_ms"_a = 5000,
-              py::call_guard< py::gil_scoped_release >() );
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "enable_statistics",
+              &rs2::syncer::enable_statistics,
+              "Start or stop collecting the latency statistics of the syncer; they are not collected by default",
+              "enable"_a = true )
+        .def( "get_statistics",
+              &rs2::syncer::get_statistics,
+              "Latency statistics of the syncer, as JSON text: per-stream hold time histograms, drop counts, and the "
+              "number of framesets released per reason" )
+        .def( "reset_statistics", &rs2::syncer::reset_statistics, "Clear the latency statistics of the syncer" )
+        .def( "get_telemetry",
+              &rs2::syncer::get_telemetry,
+              "Frame memory and queue telemetry of the syncer, as JSON text: archive counters, output queue occupancy, "
+              "and the frames held per stream" );
+
+    py::class_< rs2::multi_device_syncer, rs2::syncer > multi_device_syncer(
+        m,
+        "multi_device_syncer",
+        "Syncer that groups the frames of several devices (e.g. hardware-synced cameras) into one frameset by "
+        "timestamp. The devices must share a time domain, i.e. global time must be enabled on all of them." );
+    multi_device_syncer.def( py::init< float, float, int >(),
+                             "tolerance_ms"_a = 0.f,
+                             "max_wait_ms"_a = 100.f,
+                             "queue_size"_a = 1 );
       /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
     py::class_<rs2::align, rs2::filter> align(m, "align", "Performs alignment between depth image and another image.");
@@ -195,6 +225,16 @@ void init_processing(py::module &m) {
     py::class_<rs2::sequence_id_filter, rs2::filter> sequence_id_filter(m, "sequence_id_filter", "Splits depth frames with different sequence ID");
     sequence_id_filter.def(py::init<>())
         .def(py::init<float>(), "sequence_id"_a);
+
+    py::class_<rs2::rvl_encoder, rs2::filter> rvl_encoder(m, "rvl_encoder", "Losslessly compresses Z16 depth frames to Z16RVL");
+    rvl_encoder.def(py::init<>());
+
+    py::class_<rs2::rvl_decoder, rs2::filter> rvl_decoder(m, "rvl_decoder", "Decodes Z16RVL frames back to Z16 depth frames");
+    rvl_decoder.def(py::init<>());
+
+    py::class_<rs2::processing_graph, rs2::filter> processing_graph(m, "processing_graph", "A directed acyclic graph of processing blocks, described in JSON, "
+        "whose independent branches are processed concurrently. The graph outputs are returned as a single frameset.");
+    processing_graph.def(py::init<const std::string&>(), "json_description"_a);
     // rs2::rates_printer
     /** end rs_processing.hpp **/
 }
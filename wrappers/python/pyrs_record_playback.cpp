@@ -22,6 +22,15 @@ void init_record_playback(py::module &m) {
              "play the same way the file was recorded. If the application takes too long to handle the callback, frames may be dropped. In non real time "
              "mode, playback will wait for each callback to finish handling the data before reading the next frame. In this mode no frames will be dropped, "
              "and the application controls the framerate of playback via callback duration.", "real_time"_a)
+        .def("is_max_throughput", &rs2::playback::is_max_throughput, "Indicates if playback is reading the file as fast as possible.")
+        .def("set_max_throughput", &rs2::playback::set_max_throughput, "Set the playback to read the file as fast as possible, using all cores. "
+             "This turns real time mode off, and uses more memory to decompress more of the file ahead of the frames being played. Setting real "
+             "time mode back on turns it off.", "max_throughput"_a)
+        .def("get_frame", &rs2::playback::get_frame, "Read a frame of a stream from the file by its number, without streaming. Frames being played "
+             "back, if any, aren't affected. If more than one frame of the stream has the number, the first one is read.", "profile"_a, "frame_number"_a)
+        .def("get_frames_at", &rs2::playback::get_frames_at, "Read the frames of the given streams (every stream with frames in the file if none "
+             "are given) nearest a time in the file, as a frameset, without streaming. Frames being played back, if any, aren't affected.",
+             "time"_a, "profiles"_a = std::vector<rs2::stream_profile>())
         // set_playback_speed?
         .def("set_status_changed_callback", [](rs2::playback& self, std::function<void(rs2_playback_status)> callback) {
             self.set_status_changed_callback(callback);
@@ -33,8 +42,26 @@ void init_record_playback(py::module &m) {
     py::class_<rs2::recorder, rs2::device> recorder(m, "recorder", "Records the given device and saves it to the given file as rosbag format.");
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
+        .def(py::init<>([](const std::string& file, rs2::device dev, rsutils::json const& settings) {
+                 return rs2::recorder(file, dev, settings.dump().c_str()); }),
+             "file"_a, "device"_a, "json_settings"_a)
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("trigger", &rs2::recorder::trigger, "Writes the frames kept before the trigger, for a recorder created with "
+             "a pre-trigger setting, and everything from now on.")
+        .def("frames_written", &rs2::recorder::frames_written, "The frames of a stream written since recording started.",
+             "stream"_a, "index"_a = 0)
+        .def("frames_dropped", &rs2::recorder::frames_dropped, "The frames of a stream dropped since recording started, by the "
+             "queue-policy setting or failing to be written.", "stream"_a, "index"_a = 0)
+        .def("queue_telemetry", &rs2::recorder::queue_telemetry, "The depth of the queue of frames waiting to be written, and their latency.");
+
+    py::class_<rs2_record_queue_telemetry> queue_telemetry(m, "record_queue_telemetry", "The frames a recorder has waiting to be written, and how long they wait.");
+    queue_telemetry.def(py::init<>())
+        .def_readonly("frames", &rs2_record_queue_telemetry::frames, "Frames waiting to be written")
+        .def_readonly("bytes", &rs2_record_queue_telemetry::bytes, "Bytes of frame data waiting to be written")
+        .def_readonly("max_bytes", &rs2_record_queue_telemetry::max_bytes, "The most bytes of frame data that waited to be written at once")
+        .def_readonly("latency", &rs2_record_queue_telemetry::latency, "Milliseconds from the arrival of the last frame written until it was written")
+        .def_readonly("max_latency", &rs2_record_queue_telemetry::max_latency, "The longest such latency of any frame written, in milliseconds");
     // filename?
     /** end rs_record_playback.hpp **/
 }
@@ -44,6 +44,8 @@ void init_sensor(py::module &m) {
              "Check if specific camera info is supported.", "info")
         .def("get_info", &rs2::sensor::get_info, "Retrieve camera specific information, "
              "like versions of various internal components.", "info"_a)
+        .def("get_telemetry", &rs2::sensor::get_telemetry, "Frame memory telemetry of the sensor, as JSON text: frames "
+             "published and held, publish failures, freelist size, and bytes allocated and recycled, per frame archive")
         .def("set_notifications_callback", [](const rs2::sensor& self, std::function<void(rs2::notification)> callback) {
             self.set_notifications_callback(callback);
         }, "Register Notifications callback", "callback"_a)